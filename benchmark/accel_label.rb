@@ -0,0 +1,32 @@
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+
+amount    = 100
+keys      = ('a'..'z').to_a + ('0'..'9').to_a
+modifiers = [:control, :shift, :mod1]
+default   = Gtk3::AccelGroup.default_modifier
+
+# Populating a menu renders the same few hundred accelerators over and over.
+populate = lambda do
+  keys.each do |key|
+    modifiers.each do |modifier|
+      Gtk3::AccelGroup.accelerator_label(key, modifier)
+      Gtk3::AccelGroup.accelerator_name(key, modifier)
+    end
+  end
+end
+
+Benchmark.bmbm(25) do |bench|
+  bench.report('Populate menu (cold)') do
+    amount.times do
+      # Setting the default modifier invalidates the cache.
+      Gtk3::AccelGroup.default_modifier = default
+
+      populate.call
+    end
+  end
+
+  bench.report('Populate menu (cached)') do
+    amount.times { populate.call }
+  end
+end
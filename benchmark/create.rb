@@ -0,0 +1,31 @@
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+
+amount = 100_000
+
+Benchmark.bmbm(25) do |bench|
+  bench.report('Window.new with setters') do
+    amount.times do
+      window = Gtk3::Window.new
+
+      window.title               = 'Example'
+      window.resizable           = false
+      window.modal               = true
+      window.destroy_with_parent = true
+
+      window.destroy
+    end
+  end
+
+  bench.report('Gtk3.create') do
+    amount.times do
+      Gtk3.create(
+        :GtkWindow,
+        :title               => 'Example',
+        :resizable           => false,
+        :modal               => true,
+        :destroy_with_parent => true
+      ).destroy
+    end
+  end
+end
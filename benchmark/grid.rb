@@ -0,0 +1,30 @@
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+
+rows    = 100
+columns = 100
+
+Benchmark.bmbm(25) do |bench|
+  bench.report('Grid#attach') do
+    grid = Gtk3::Grid.new
+
+    rows.times do |row|
+      columns.times do |column|
+        grid.attach(Gtk3.create(:GtkLabel, :label => 'x'), column, row)
+      end
+    end
+  end
+
+  bench.report('Grid#attach_all') do
+    grid  = Gtk3::Grid.new
+    specs = []
+
+    rows.times do |row|
+      columns.times do |column|
+        specs << [Gtk3.create(:GtkLabel, :label => 'x'), column, row]
+      end
+    end
+
+    grid.attach_all(specs)
+  end
+end
@@ -0,0 +1,17 @@
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+
+abort('Gtk3 was built without introspection support') unless Gtk3::INTROSPECTION
+
+amount = 100_000
+label  = Gtk3.create(:GtkLabel)
+
+Benchmark.bmbm(25) do |bench|
+  bench.report('Object#set') do
+    amount.times { label.set(:label => 'Saved') }
+  end
+
+  bench.report('Label#set_text') do
+    amount.times { label.set_text('Saved') }
+  end
+end
@@ -0,0 +1,30 @@
+require 'benchmark'
+require 'rbconfig'
+
+amount  = 20
+library = File.expand_path('../../lib/gtk3', __FILE__)
+ruby    = RbConfig.ruby
+
+# Environment without any display, GTK can't be initialized using this.
+headless = {'DISPLAY' => nil, 'WAYLAND_DISPLAY' => nil}
+
+scripts = {
+  'require'                 => "require #{library.inspect}",
+  'require + Gtk3.init'     => "require #{library.inspect}; Gtk3.init",
+  'require + accel helpers' => "require #{library.inspect}; " \
+    "Gtk3::AccelGroup.accelerator_label(113, :control)"
+}
+
+Benchmark.bmbm(35) do |bench|
+  scripts.each do |name, script|
+    bench.report(name) do
+      amount.times { system(ruby, '-e', script) }
+    end
+
+    next if script.include?('Gtk3.init')
+
+    bench.report("#{name} (no display)") do
+      amount.times { system(headless, ruby, '-e', script) }
+    end
+  end
+end
@@ -0,0 +1,49 @@
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+require 'tmpdir'
+
+amount = 200
+
+Dir.mktmpdir do |dir|
+  files = Array.new(amount) { |index| "view#{index}.ui" }
+
+  files.each_with_index do |file, index|
+    File.open(File.join(dir, file), 'w') do |handle|
+      handle.write(
+        %Q{<interface><object class="GtkBox" id="box#{index}"/></interface>}
+      )
+    end
+  end
+
+  File.open(File.join(dir, 'app.gresource.xml'), 'w') do |handle|
+    handle.write('<gresources><gresource prefix="/benchmark">')
+
+    files.each { |file| handle.write("<file>#{file}</file>") }
+
+    handle.write('</gresource></gresources>')
+  end
+
+  system(
+    'glib-compile-resources',
+    "--sourcedir=#{dir}",
+    "--target=#{dir}/app.gresource",
+    "#{dir}/app.gresource.xml"
+  ) or abort('glib-compile-resources is required for this benchmark')
+
+  Benchmark.bmbm(25) do |bench|
+    bench.report('per-file loading') do
+      builder = Gtk3::Builder.new
+
+      files.each { |file| builder.add_from_file(File.join(dir, file)) }
+    end
+
+    bench.report('resource bundle') do
+      bundle  = Gtk3::Resource.load(File.join(dir, 'app.gresource')).register
+      builder = Gtk3::Builder.new
+
+      files.each { |file| builder.add_from_file("resource:///benchmark/#{file}") }
+
+      bundle.unregister
+    end
+  end
+end
@@ -0,0 +1,30 @@
+# encoding: utf-8
+
+require File.expand_path('../../lib/gtk3', __FILE__)
+require 'benchmark'
+
+amount = 100
+window = Gtk3::Window.new
+utf8   = ("café " * 200_000).freeze
+latin1 = utf8.encode('ISO-8859-1').freeze
+binary = utf8.dup.force_encoding('BINARY').freeze
+
+Benchmark.bmbm(25) do |bench|
+  bench.report('1 MB UTF-8 title') do
+    amount.times { window.title = utf8 }
+  end
+
+  bench.report('1 MB ISO-8859-1 title') do
+    amount.times { window.title = latin1 }
+  end
+
+  bench.report('1 MB binary title') do
+    amount.times { window.title = binary }
+  end
+
+  bench.report('1 MB title via set') do
+    amount.times { window.set(:title => utf8) }
+  end
+end
+
+window.destroy
@@ -0,0 +1,301 @@
+#include "accel_cache.h"
+#include <locale.h>
+
+/**
+ * The maximum amount of accelerators to keep in the cache. When the cache is
+ * full the least recently used accelerator is removed.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_ACCEL_CACHE_LIMIT 512
+
+/**
+ * Structure containing the cached name and label of an accelerator. The name
+ * and label are nil until they're requested for the first time.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelCacheEntry
+{
+    guint key;
+    GdkModifierType modifier;
+    VALUE name;
+    VALUE label;
+    GList *link;
+} RAccelCacheEntry;
+
+/**
+ * Hash table that maps a key and modifier to a RAccelCacheEntry.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_cache_entries;
+
+/**
+ * Queue of all the entries, ordered from most to least recently used.
+ *
+ * @since 2026-10-19
+ */
+static GQueue gtk3_accel_cache_order = G_QUEUE_INIT;
+
+/**
+ * Hidden Ruby object that marks the Strings in the cache.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_accel_cache_keeper;
+
+/**
+ * The value of LC_MESSAGES the labels in the cache were created for.
+ *
+ * @since 2026-10-19
+ */
+static gchar *gtk3_accel_cache_locale = NULL;
+
+/**
+ * Set to TRUE once the cache is cleared whenever the keymap changes.
+ *
+ * @since 2026-10-19
+ */
+static gboolean gtk3_accel_cache_watching_keymap = FALSE;
+
+/**
+ * Hashes the key and modifier of a cache entry.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] data The entry to hash.
+ * @return [guint]
+ */
+static guint gtk3_accel_cache_entry_hash(gconstpointer data)
+{
+    const RAccelCacheEntry *entry = data;
+
+    return entry->key ^ ((guint) entry->modifier << 16);
+}
+
+/**
+ * Returns TRUE if two cache entries are for the same key and modifier.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] a The first entry.
+ * @param  [gconstpointer] b The second entry.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_cache_entry_equal(gconstpointer a, gconstpointer b)
+{
+    const RAccelCacheEntry *entry_a = a;
+    const RAccelCacheEntry *entry_b = b;
+
+    return entry_a->key == entry_b->key
+        && entry_a->modifier == entry_b->modifier;
+}
+
+/**
+ * Marks the Strings stored in the cache.
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_accel_cache_mark(void *data)
+{
+    GList *link;
+    RAccelCacheEntry *entry;
+
+    for ( link = gtk3_accel_cache_order.head; link != NULL; link = link->next )
+    {
+        entry = link->data;
+
+        rb_gc_mark(entry->name);
+        rb_gc_mark(entry->label);
+    }
+}
+
+/**
+ * Removes all the accelerators from the cache.
+ *
+ * @since 2026-10-19
+ */
+void gtk3_accel_cache_clear()
+{
+    g_queue_clear(&gtk3_accel_cache_order);
+    g_hash_table_remove_all(gtk3_accel_cache_entries);
+}
+
+/**
+ * Called by GDK whenever the keymap changes.
+ *
+ * @since 2026-10-19
+ * @param [GdkKeymap *] keymap The keymap that changed.
+ * @param [gpointer] data Unused.
+ */
+static void gtk3_accel_cache_keys_changed(GdkKeymap *keymap, gpointer data)
+{
+    gtk3_accel_cache_clear();
+}
+
+/**
+ * Clears the cache if the locale used for the labels changed and starts
+ * watching the keymap once a display is available.
+ *
+ * @since 2026-10-19
+ */
+static void gtk3_accel_cache_validate()
+{
+    GdkDisplay *display;
+#ifdef LC_MESSAGES
+    const gchar *locale = setlocale(LC_MESSAGES, NULL);
+
+    if ( g_strcmp0(locale, gtk3_accel_cache_locale) != 0 )
+    {
+        gtk3_accel_cache_clear();
+
+        g_free(gtk3_accel_cache_locale);
+
+        gtk3_accel_cache_locale = g_strdup(locale);
+    }
+#endif
+
+    if ( !gtk3_accel_cache_watching_keymap )
+    {
+        display = gdk_display_get_default();
+
+        if ( display != NULL )
+        {
+            g_signal_connect(
+                gdk_keymap_get_for_display(display),
+                "keys-changed",
+                G_CALLBACK(gtk3_accel_cache_keys_changed),
+                NULL
+            );
+
+            gtk3_accel_cache_watching_keymap = TRUE;
+        }
+    }
+}
+
+/**
+ * Returns the cache entry for the given key and modifier, creating it if
+ * needed and marking it as the most recently used entry.
+ *
+ * @since  2026-10-19
+ * @param  [guint] key The accelerator key.
+ * @param  [GdkModifierType] modifier The accelerator modifier.
+ * @return [RAccelCacheEntry *]
+ */
+static RAccelCacheEntry *gtk3_accel_cache_lookup(
+    guint key,
+    GdkModifierType modifier
+)
+{
+    RAccelCacheEntry query;
+    RAccelCacheEntry *entry;
+
+    gtk3_accel_cache_validate();
+
+    query.key      = key;
+    query.modifier = modifier;
+
+    entry = g_hash_table_lookup(gtk3_accel_cache_entries, &query);
+
+    if ( entry != NULL )
+    {
+        g_queue_unlink(&gtk3_accel_cache_order, entry->link);
+        g_queue_push_head_link(&gtk3_accel_cache_order, entry->link);
+
+        return entry;
+    }
+
+    if ( gtk3_accel_cache_order.length >= GTK3_ACCEL_CACHE_LIMIT )
+    {
+        g_hash_table_remove(
+            gtk3_accel_cache_entries,
+            g_queue_pop_tail(&gtk3_accel_cache_order)
+        );
+    }
+
+    entry           = g_new(RAccelCacheEntry, 1);
+    entry->key      = key;
+    entry->modifier = modifier;
+    entry->name     = Qnil;
+    entry->label    = Qnil;
+
+    g_queue_push_head(&gtk3_accel_cache_order, entry);
+
+    entry->link = gtk3_accel_cache_order.head;
+
+    g_hash_table_insert(gtk3_accel_cache_entries, entry, entry);
+
+    return entry;
+}
+
+/**
+ * Returns the accelerator name of a key and modifier as a frozen String.
+ *
+ * @since  2026-10-19
+ * @param  [guint] key The accelerator key.
+ * @param  [GdkModifierType] modifier The accelerator modifier.
+ * @return [String]
+ */
+VALUE gtk3_accel_cache_name(guint key, GdkModifierType modifier)
+{
+    gchar *name;
+    RAccelCacheEntry *entry = gtk3_accel_cache_lookup(key, modifier);
+
+    if ( NIL_P(entry->name) )
+    {
+        name        = gtk_accelerator_name(key, modifier);
+        entry->name = rb_obj_freeze(gtk3_utf8_new(name));
+
+        g_free(name);
+    }
+
+    return entry->name;
+}
+
+/**
+ * Returns the user friendly label of a key and modifier as a frozen String.
+ *
+ * @since  2026-10-19
+ * @param  [guint] key The accelerator key.
+ * @param  [GdkModifierType] modifier The accelerator modifier.
+ * @return [String]
+ */
+VALUE gtk3_accel_cache_label(guint key, GdkModifierType modifier)
+{
+    gchar *label;
+    RAccelCacheEntry *entry = gtk3_accel_cache_lookup(key, modifier);
+
+    if ( NIL_P(entry->label) )
+    {
+        label        = gtk_accelerator_get_label(key, modifier);
+        entry->label = rb_obj_freeze(gtk3_utf8_new(label));
+
+        g_free(label);
+    }
+
+    return entry->label;
+}
+
+/**
+ * Sets up the accelerator cache.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_cache()
+{
+    gtk3_accel_cache_entries = g_hash_table_new_full(
+        gtk3_accel_cache_entry_hash,
+        gtk3_accel_cache_entry_equal,
+        NULL,
+        g_free
+    );
+
+    gtk3_accel_cache_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_accel_cache_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_accel_cache_keeper);
+}
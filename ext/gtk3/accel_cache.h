@@ -0,0 +1,12 @@
+#ifndef GTK3_ACCEL_CACHE
+#define GTK3_ACCEL_CACHE
+
+#include "gtk3.h"
+
+extern VALUE gtk3_accel_cache_name(guint key, GdkModifierType modifier);
+extern VALUE gtk3_accel_cache_label(guint key, GdkModifierType modifier);
+extern void gtk3_accel_cache_clear();
+
+extern void Init_gtk3_accel_cache();
+
+#endif
@@ -25,26 +25,21 @@ VALUE gtk3_cAccelGroup;
  */
 static VALUE gtk3_accel_group_new(VALUE class)
 {
-    VALUE struct_data;
-    GtkAccelGroup *group;
+    VALUE rb_group;
+    GtkAccelGroup *group = gtk_accel_group_new();
 
-    group       = gtk_accel_group_new();
-    struct_data = Data_Wrap_Struct(
-        class,
-        NULL,
-        NULL,
-        group
-    );
+    rb_group = gtk3_object_wrap(class, group, TRUE);
 
-    rb_obj_call_init(struct_data, 0, NULL);
+    rb_obj_call_init(rb_group, 0, NULL);
 
-    return struct_data;
+    return rb_group;
 }
 
 /**
  * Parses a key code and modifier and returns the accelerator name (also known
  * as "path"). If no accelerator name is found an empty string is returned
- * instead.
+ * instead. The returned String is frozen and cached until the keymap, locale
+ * or default modifier changes.
  *
  * @example
  *  Gtk3::AccelGroup.accelerator_name(:q, :shift) => "<Shift>q"
@@ -63,12 +58,14 @@ static VALUE gtk3_accel_group_accelerator_name(
     key      = gtk3_lookup_accelerator_key(key);
     modifier = gtk3_lookup_accelerator_modifier(modifier);
 
-    return rb_str_new2(gtk_accelerator_name(NUM2INT(key), NUM2INT(modifier)));
+    return gtk3_accel_cache_name(NUM2INT(key), NUM2INT(modifier));
 }
 
 /**
  * Returns a string containing a user friendly representation of an accelerator
- * key and modifier. If no label is found an empty string is returned.
+ * key and modifier. If no label is found an empty string is returned. The
+ * returned String is frozen and cached until the keymap, locale or default
+ * modifier changes.
  *
  * @since  2012-06-10
  * @param  [Fixnum|Bignum|String|Symbol] key The accelerator key.
@@ -84,9 +81,7 @@ static VALUE gtk3_accel_group_accelerator_label(
     key      = gtk3_lookup_accelerator_key(key);
     modifier = gtk3_lookup_accelerator_modifier(modifier);
 
-    return rb_str_new2(
-        gtk_accelerator_get_label(NUM2INT(key), NUM2INT(modifier))
-    );
+    return gtk3_accel_cache_label(NUM2INT(key), NUM2INT(modifier));
 }
 
 /**
@@ -120,6 +115,8 @@ static VALUE gtk3_accel_group_set_default_modifier(VALUE class, VALUE mod)
 
     gtk_accelerator_set_default_mod_mask(NUM2INT(mod));
 
+    gtk3_accel_cache_clear();
+
     return Qnil;
 }
 
@@ -285,7 +282,7 @@ static VALUE gtk3_accel_group_connect(
 
     Data_Get_Struct(self, GtkAccelGroup, group);
 
-    closure = gtk3_closure_new(rb_block_proc(), self);
+    closure = gtk3_closure_new(rb_block_proc(), NULL);
 
     gtk_accel_group_connect(
         group,
@@ -326,9 +323,9 @@ static VALUE gtk3_accel_group_connect_by_path(VALUE self, VALUE path)
 
     Data_Get_Struct(self, GtkAccelGroup, group);
 
-    path_gchar = StringValuePtr(path);
+    path_gchar = gtk3_string_value_utf8(&path);
 
-    closure = gtk3_closure_new(rb_block_proc(), self);
+    closure = gtk3_closure_new(rb_block_proc(), NULL);
 
     gtk_accel_group_connect_by_path(group, path_gchar, (GClosure *) closure);
 
@@ -368,7 +365,8 @@ static VALUE gtk3_accel_group_disconnect_key(VALUE self, VALUE key, VALUE mod)
 
 /**
  * Queries an accelerator group for the given key and modifier. The return
- * value is an array of instances of {Gtk3::AccelGroupEntry} objects.
+ * value is an array of instances of {Gtk3::AccelGroupEntry} objects. Use
+ * {Gtk3::AccelGroup#query\_count} if you only need the amount of entries.
  *
  * @example
  *  group = Gtk3::AccelGroup.new
@@ -382,20 +380,11 @@ static VALUE gtk3_accel_group_disconnect_key(VALUE self, VALUE key, VALUE mod)
  */
 static VALUE gtk3_accel_group_query(VALUE self, VALUE key, VALUE mod)
 {
-    VALUE rb_entries = rb_ary_new();
-
+    VALUE rb_entries;
     GtkAccelGroup *group;
     GtkAccelGroupEntry *entries;
     guint n_entries;
-
-    /*
-    Variables used when looping over the return value of
-    gtk_accel_group_query().
-    */
-    unsigned int entry_index;
-    VALUE entry;
-    GtkAccelKey entry_key;
-    RClosure *entry_closure;
+    guint index;
 
     key = gtk3_lookup_accelerator_key(key);
     mod = gtk3_lookup_accelerator_modifier(mod);
@@ -409,31 +398,359 @@ static VALUE gtk3_accel_group_query(VALUE self, VALUE key, VALUE mod)
         &n_entries
     );
 
-    /*
-    Loop through each entry and convert it to a Ruby instance of
-    {Gtk3::AccelGroupEntry}.
-    */
-    for ( entry_index = 0; entry_index < n_entries; entry_index++ )
+    rb_entries = rb_ary_new2(n_entries);
+
+    for ( index = 0; index < n_entries; index++ )
     {
-        entry_key     = entries[entry_index].key;
-        entry_closure = (RClosure *) entries[entry_index].closure;
-
-        entry = rb_funcall(
-            gtk3_cAccelGroupEntry,
-            gtk3_id_new,
-            4,
-            INT2NUM(entry_key.accel_key),
-            INT2NUM(entry_key.accel_mods),
-            INT2NUM(entry_key.accel_flags),
-            entry_closure->proc
+        rb_ary_push(
+            rb_entries,
+            gtk3_accel_group_entry_new(
+                &entries[index].key,
+                entries[index].closure
+            )
         );
+    }
+
+    return rb_entries;
+}
+
+/**
+ * Returns the amount of accelerators in the group for the given key and
+ * modifier. Unlike {Gtk3::AccelGroup#query} this method doesn't create any
+ * objects.
+ *
+ * @example
+ *  group = Gtk3::AccelGroup.new
+ *
+ *  group.connect(:q, :control, :visible) {}
+ *  group.query_count(:q, :control) # => 1
+ *
+ * @since  2026-10-19
+ * @param  [Fixnum|Bignum|String|Symbol] key The key number to query.
+ * @param  [Fixnum|Bignum|String|Symbol] mod The modifier to query.
+ * @return [Fixnum]
+ */
+static VALUE gtk3_accel_group_query_count(VALUE self, VALUE key, VALUE mod)
+{
+    GtkAccelGroup *group;
+    guint n_entries = 0;
+
+    key = gtk3_lookup_accelerator_key(key);
+    mod = gtk3_lookup_accelerator_modifier(mod);
+
+    Data_Get_Struct(self, GtkAccelGroup, group);
+
+    gtk_accel_group_query(group, NUM2INT(key), NUM2INT(mod), &n_entries);
+
+    return UINT2NUM(n_entries);
+}
+
+/**
+ * Activates the accelerators of the group for the given key and modifier as
+ * if the key was pressed in the given object. Returns `true` if any of the
+ * callbacks handled the key press. Exceptions raised by the callbacks are
+ * raised once all callbacks have been called.
+ *
+ * @example
+ *  group.bind_table('<Control>s' => proc { save; true })
+ *  group.activate(window, :s, :control) # => true
+ *
+ * @since  2026-10-19
+ * @param  [Gtk3::Window] object The object the key was pressed in.
+ * @param  [Fixnum|Bignum|String|Symbol] key The key to activate.
+ * @param  [Fixnum|Bignum|String|Symbol] mod The modifier to activate.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_accel_group_activate(
+    VALUE self,
+    VALUE object,
+    VALUE key,
+    VALUE mod
+)
+{
+    gchar *name;
+    GQuark quark;
+    guint key_guint;
+    gboolean handled;
+    GdkModifierType gdk_modifier;
+    GtkAccelGroup *group;
+    GObject *acceleratable;
+
+    key_guint     = NUM2INT(gtk3_lookup_accelerator_key(key));
+    gdk_modifier  = NUM2INT(gtk3_lookup_accelerator_modifier(mod));
+    acceleratable = gtk3_object_unwrap(object, G_TYPE_OBJECT);
 
-        rb_ary_push(rb_entries, entry);
+    Data_Get_Struct(self, GtkAccelGroup, group);
+
+    /* Accelerators are connected using the name of the key and modifier. */
+    gdk_modifier &= gtk_accelerator_get_default_mod_mask();
+
+    name  = gtk_accelerator_name(key_guint, gdk_modifier);
+    quark = g_quark_try_string(name);
+
+    g_free(name);
+
+    if ( quark == 0 )
+    {
+        return Qfalse;
+    }
+
+    handled = gtk_accel_group_activate(
+        group,
+        quark,
+        acceleratable,
+        key_guint,
+        gdk_modifier
+    );
+
+    /* Exceptions of the callbacks can only be raised once GTK returns. */
+    gtk3_raise_pending();
+
+    return gtk3_gboolean_to_rboolean(handled);
+}
+
+/**
+ * Called by gtk_accel_group_find() for every accelerator in a group. The
+ * accelerator is added to the GArray passed as the data argument and a
+ * reference to its closure is taken.
+ *
+ * @since  2026-10-19
+ * @param  [GtkAccelKey *] key The key, modifier and flags of the accelerator.
+ * @param  [GClosure *] closure The closure of the accelerator.
+ * @param  [gpointer] data The GArray to add the accelerator to.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_group_collect(
+    GtkAccelKey *key,
+    GClosure *closure,
+    gpointer data
+)
+{
+    GtkAccelGroupEntry entry;
+
+    entry.key              = *key;
+    entry.closure          = g_closure_ref(closure);
+    entry.accel_path_quark = 0;
+
+    g_array_append_val((GArray *) data, entry);
+
+    return FALSE;
+}
+
+/**
+ * Called by gtk_accel_group_find() to count the accelerators in a group.
+ *
+ * @since  2026-10-19
+ * @param  [GtkAccelKey *] key The key, modifier and flags of the accelerator.
+ * @param  [GClosure *] closure The closure of the accelerator.
+ * @param  [gpointer] data Pointer to the counter.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_group_count(
+    GtkAccelKey *key,
+    GClosure *closure,
+    gpointer data
+)
+{
+    (*(guint *) data)++;
+
+    return FALSE;
+}
+
+/**
+ * Creates an Array of {Gtk3::AccelGroupEntry} instances for the accelerators
+ * collected by gtk3_accel_group_collect().
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GArray containing the accelerators.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_group_wrap_entries(VALUE data)
+{
+    guint index;
+    VALUE rb_entries;
+    GArray *entries = (GArray *) data;
+    GtkAccelGroupEntry *entry;
+
+    rb_entries = rb_ary_new2(entries->len);
+
+    for ( index = 0; index < entries->len; index++ )
+    {
+        entry = &g_array_index(entries, GtkAccelGroupEntry, index);
+
+        rb_ary_push(
+            rb_entries,
+            gtk3_accel_group_entry_new(&entry->key, entry->closure)
+        );
     }
 
     return rb_entries;
 }
 
+/**
+ * Yields a {Gtk3::AccelGroupEntry} for every accelerator collected by
+ * gtk3_accel_group_collect(). Every entry is created right before it's
+ * yielded.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GArray containing the accelerators.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_group_yield_entries(VALUE data)
+{
+    guint index;
+    GArray *entries = (GArray *) data;
+    GtkAccelGroupEntry *entry;
+
+    for ( index = 0; index < entries->len; index++ )
+    {
+        entry = &g_array_index(entries, GtkAccelGroupEntry, index);
+
+        rb_yield(gtk3_accel_group_entry_new(&entry->key, entry->closure));
+    }
+
+    return Qnil;
+}
+
+/**
+ * Collects the accelerators of a group into a GArray, taking a reference to
+ * every closure. The GArray must be freed using
+ * gtk3_accel_group_free_entries().
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] self The Ruby object of the group.
+ * @return [GArray *]
+ */
+static GArray *gtk3_accel_group_collect_entries(VALUE self)
+{
+    GtkAccelGroup *group;
+    GArray *entries;
+
+    Data_Get_Struct(self, GtkAccelGroup, group);
+
+    entries = g_array_new(FALSE, FALSE, sizeof(GtkAccelGroupEntry));
+
+    gtk_accel_group_find(group, gtk3_accel_group_collect, entries);
+
+    return entries;
+}
+
+/**
+ * Drops the closure references taken by gtk3_accel_group_collect() and frees
+ * the GArray.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GArray containing the accelerators.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_group_free_entries(VALUE data)
+{
+    guint index;
+    GArray *entries = (GArray *) data;
+    GtkAccelGroupEntry *entry;
+
+    for ( index = 0; index < entries->len; index++ )
+    {
+        entry = &g_array_index(entries, GtkAccelGroupEntry, index);
+
+        g_closure_unref(entry->closure);
+    }
+
+    g_array_free(entries, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Returns an Array containing all the accelerators of a group. The
+ * accelerators are collected before any Ruby objects are created.
+ *
+ * @example
+ *  group = Gtk3::AccelGroup.new
+ *
+ *  group.connect(:q, :control, :visible) {}
+ *  group.to_a # => [#<Gtk3::AccelGroupEntry ...>]
+ *
+ * @since  2026-10-19
+ * @return [Array]
+ */
+static VALUE gtk3_accel_group_to_a(VALUE self)
+{
+    GArray *entries = gtk3_accel_group_collect_entries(self);
+
+    return rb_ensure(
+        gtk3_accel_group_wrap_entries,
+        (VALUE) entries,
+        gtk3_accel_group_free_entries,
+        (VALUE) entries
+    );
+}
+
+/**
+ * Returns the amount of accelerators in a group.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_accel_group_size(VALUE self)
+{
+    GtkAccelGroup *group;
+    guint amount = 0;
+
+    Data_Get_Struct(self, GtkAccelGroup, group);
+
+    gtk_accel_group_find(group, gtk3_accel_group_count, &amount);
+
+    return UINT2NUM(amount);
+}
+
+/**
+ * Returns the size of the Enumerator returned by {Gtk3::AccelGroup#each}.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_accel_group_enum_size(VALUE self, VALUE args, VALUE eobj)
+{
+    return gtk3_accel_group_size(self);
+}
+
+/**
+ * Yields every accelerator of a group as an instance of
+ * {Gtk3::AccelGroupEntry}. All accelerators are collected when the iteration
+ * starts so the block can safely change the group, the entries are created
+ * one at a time as they're yielded. An Enumerator is returned when no block
+ * is given.
+ *
+ * @example
+ *  group.each { |entry| puts entry.path }
+ *
+ * @since  2026-10-19
+ * @yield  [entry]
+ * @return [Gtk3::AccelGroup|Enumerator]
+ */
+static VALUE gtk3_accel_group_each(VALUE self)
+{
+    GArray *entries;
+
+#ifdef RETURN_SIZED_ENUMERATOR
+    RETURN_SIZED_ENUMERATOR(self, 0, 0, gtk3_accel_group_enum_size);
+#else
+    RETURN_ENUMERATOR(self, 0, 0);
+#endif
+
+    entries = gtk3_accel_group_collect_entries(self);
+
+    rb_ensure(
+        gtk3_accel_group_yield_entries,
+        (VALUE) entries,
+        gtk3_accel_group_free_entries,
+        (VALUE) entries
+    );
+
+    return self;
+}
+
 /**
  * Initializes the class, required variables, etc.
  *
@@ -444,9 +761,11 @@ void Init_gtk3_accel_group()
     gtk3_cAccelGroup = rb_define_class_under(
         gtk3_mGtk3,
         "AccelGroup",
-        rb_cObject
+        gtk3_cObject
     );
 
+    gtk3_object_register_class(GTK_TYPE_ACCEL_GROUP, gtk3_cAccelGroup);
+
     rb_define_singleton_method(
         gtk3_cAccelGroup,
         "new",
@@ -521,4 +840,24 @@ void Init_gtk3_accel_group()
     );
 
     rb_define_method(gtk3_cAccelGroup, "query", gtk3_accel_group_query, 2);
+
+    rb_define_method(
+        gtk3_cAccelGroup,
+        "query_count",
+        gtk3_accel_group_query_count,
+        2
+    );
+
+    rb_define_method(
+        gtk3_cAccelGroup,
+        "activate",
+        gtk3_accel_group_activate,
+        3
+    );
+
+    rb_include_module(gtk3_cAccelGroup, rb_mEnumerable);
+
+    rb_define_method(gtk3_cAccelGroup, "each", gtk3_accel_group_each, 0);
+    rb_define_method(gtk3_cAccelGroup, "to_a", gtk3_accel_group_to_a, 0);
+    rb_define_method(gtk3_cAccelGroup, "size", gtk3_accel_group_size, 0);
 }
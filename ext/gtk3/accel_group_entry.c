@@ -1,12 +1,5 @@
 #include "accel_group_entry.h"
 
-/**
- * ID for the `:accelerator_name` symbol.
- *
- * @since 2012-06-14
- */
-ID gtk3_id_accelerator_name;
-
 /**
  * Document-class: Gtk3::AccelGroupEntry
  *
@@ -16,35 +9,152 @@ ID gtk3_id_accelerator_name;
  *
  * Using this class on its own doesn't make a whole lot of sense since it
  * mostly acts as a data container. Internally it's used by methods such as
- * {Gtk3::AccelGroup#query}.
- *
- * @!attribute [r] key
- *   Numeric value of the key the entry is associated with.
- *   @since  2012-06-17
- *   @return [Fixnum|Bignum]
- * @!attribute [r] modifier
- *   The modifier of the accelerator entry.
- *   @since  2012-06-17
- *   @return [Fixnum|Bignum]
- * @!attribute [r] flags
- *   The accelerator flags of the entry.
- *   @since  2012-06-17
- *   @return [Fixnum|Bignum]
- * @!attribute [r] path
- *   String that represents the accelerator path. For example, if the key is
- *   set to "q" (numeric value of 113) and the modifier to "control" then the
- *   path will be "<Primary>q" ("Primary" is "Control" in GTK).
- *   @since  2012-06-17
- *   @return [String]
- * @!attribute [r] callback
- *   The proc to call when activating the entry.
- *   @since  2012-06-17
- *   @return [Proc]
+ * {Gtk3::AccelGroup#query}. Entries returned by these methods store the raw
+ * GTK data, the path and callback are only looked up when they're read.
  *
  * @since 2012-06-10
  */
 VALUE gtk3_cAccelGroupEntry;
 
+/**
+ * Marks the callback and path of an entry.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The RAccelGroupEntry structure.
+ */
+static void gtk3_accel_group_entry_mark(void *data)
+{
+    RAccelGroupEntry *entry = (RAccelGroupEntry *) data;
+
+    if ( entry->callback != Qundef )
+    {
+        rb_gc_mark(entry->callback);
+    }
+
+    if ( entry->path != Qundef )
+    {
+        rb_gc_mark(entry->path);
+    }
+}
+
+/**
+ * Drops the reference to the closure of an entry and frees the structure.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The RAccelGroupEntry structure.
+ */
+static void gtk3_accel_group_entry_free(void *data)
+{
+    RAccelGroupEntry *entry = (RAccelGroupEntry *) data;
+
+    if ( entry->closure != NULL )
+    {
+        g_closure_unref(entry->closure);
+    }
+
+    g_free(entry);
+}
+
+/**
+ * Returns the memory size of an RAccelGroupEntry structure.
+ *
+ * @since  2026-10-19
+ * @param  [const void *] data The RAccelGroupEntry structure.
+ * @return [size_t]
+ */
+static size_t gtk3_accel_group_entry_size(const void *data)
+{
+    return sizeof(RAccelGroupEntry);
+}
+
+/**
+ * Data type of {Gtk3::AccelGroupEntry} instances.
+ *
+ * @since 2026-10-19
+ */
+static const rb_data_type_t gtk3_accel_group_entry_type = {
+    "Gtk3::AccelGroupEntry",
+    {
+        gtk3_accel_group_entry_mark,
+        gtk3_accel_group_entry_free,
+        gtk3_accel_group_entry_size,
+    },
+};
+
+/**
+ * Allocates a new, empty entry.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] klass The class to allocate.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_group_entry_allocate(VALUE klass)
+{
+    RAccelGroupEntry *entry;
+    VALUE rb_entry;
+
+    rb_entry = TypedData_Make_Struct(
+        klass,
+        RAccelGroupEntry,
+        &gtk3_accel_group_entry_type,
+        entry
+    );
+
+    entry->closure  = NULL;
+    entry->callback = Qnil;
+    entry->path     = Qundef;
+
+    return rb_entry;
+}
+
+/**
+ * Returns the RAccelGroupEntry structure of an entry.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] self The entry.
+ * @return [RAccelGroupEntry *]
+ */
+static RAccelGroupEntry *gtk3_accel_group_entry_get(VALUE self)
+{
+    RAccelGroupEntry *entry;
+
+    TypedData_Get_Struct(
+        self,
+        RAccelGroupEntry,
+        &gtk3_accel_group_entry_type,
+        entry
+    );
+
+    return entry;
+}
+
+/**
+ * Creates a new entry for an accelerator of an accelerator group without
+ * calling into Ruby. A reference to the closure is kept for as long as the
+ * entry is alive.
+ *
+ * @since  2026-10-19
+ * @param  [const GtkAccelKey *] key The accelerator key, modifier and flags.
+ * @param  [GClosure *] closure The closure of the accelerator.
+ * @return [VALUE]
+ */
+VALUE gtk3_accel_group_entry_new(const GtkAccelKey *key, GClosure *closure)
+{
+    VALUE rb_entry = gtk3_accel_group_entry_allocate(gtk3_cAccelGroupEntry);
+    RAccelGroupEntry *entry = gtk3_accel_group_entry_get(rb_entry);
+
+    entry->key      = *key;
+    entry->closure  = closure;
+    entry->callback = Qundef;
+
+    if ( closure != NULL )
+    {
+        g_closure_ref(closure);
+    }
+
+    return rb_entry;
+}
+
 /**
  * Creates a new instance of the class and stores the accelerator key, callback
  * and accelerator path.
@@ -63,35 +173,110 @@ static VALUE gtk3_accel_group_entry_initialize(
     VALUE callback
 )
 {
-    char *callback_class = gtk3_get_rbclass(callback);
+    RAccelGroupEntry *entry = gtk3_accel_group_entry_get(self);
 
     gtk3_check_number(key);
     gtk3_check_number(mod);
     gtk3_check_number(flags);
 
-    if ( strcmp(callback_class, "Proc") )
+    if ( !rb_obj_is_proc(callback) )
     {
         rb_raise(
             rb_eTypeError,
             "wrong argument type %s (expected Proc)",
-            callback_class
+            rb_obj_classname(callback)
         );
     }
 
-    rb_iv_set(self, "@key", key);
-    rb_iv_set(self, "@modifier", mod);
-    rb_iv_set(self, "@flags", flags);
-    rb_iv_set(self, "@callback", callback);
-
-    rb_iv_set(
-        self,
-        "@path",
-        rb_funcall(gtk3_cAccelGroup, gtk3_id_accelerator_name, 2, key, mod)
-    );
+    entry->key.accel_key   = NUM2UINT(key);
+    entry->key.accel_mods  = NUM2UINT(mod);
+    entry->key.accel_flags = NUM2UINT(flags);
+    entry->callback        = callback;
 
     return self;
 }
 
+/**
+ * Returns the numeric value of the key the entry is associated with.
+ *
+ * @since  2012-06-17
+ * @return [Fixnum|Bignum]
+ */
+static VALUE gtk3_accel_group_entry_key(VALUE self)
+{
+    return UINT2NUM(gtk3_accel_group_entry_get(self)->key.accel_key);
+}
+
+/**
+ * Returns the modifier of the accelerator entry.
+ *
+ * @since  2012-06-17
+ * @return [Fixnum|Bignum]
+ */
+static VALUE gtk3_accel_group_entry_modifier(VALUE self)
+{
+    return UINT2NUM(gtk3_accel_group_entry_get(self)->key.accel_mods);
+}
+
+/**
+ * Returns the accelerator flags of the entry.
+ *
+ * @since  2012-06-17
+ * @return [Fixnum|Bignum]
+ */
+static VALUE gtk3_accel_group_entry_flags(VALUE self)
+{
+    return UINT2NUM(gtk3_accel_group_entry_get(self)->key.accel_flags);
+}
+
+/**
+ * Returns a String that represents the accelerator path. For example, if the
+ * key is set to "q" (numeric value of 113) and the modifier to "control" then
+ * the path will be "<Primary>q" ("Primary" is "Control" in GTK).
+ *
+ * @since  2012-06-17
+ * @return [String]
+ */
+static VALUE gtk3_accel_group_entry_path(VALUE self)
+{
+    RAccelGroupEntry *entry = gtk3_accel_group_entry_get(self);
+
+    if ( entry->path == Qundef )
+    {
+        entry->path = gtk3_accel_cache_name(
+            entry->key.accel_key,
+            entry->key.accel_mods
+        );
+    }
+
+    return entry->path;
+}
+
+/**
+ * Returns the proc (or other callable) to call when activating the entry.
+ * Entries for accelerators that weren't connected from Ruby return nil.
+ *
+ * @since  2012-06-17
+ * @return [Proc|Object|NilClass]
+ */
+static VALUE gtk3_accel_group_entry_callback(VALUE self)
+{
+    RAccelGroupEntry *entry = gtk3_accel_group_entry_get(self);
+
+    if ( entry->callback == Qundef )
+    {
+        entry->callback = gtk3_closure_proc(entry->closure);
+
+        /* Accelerators installed using Gtk3::AccelGroup#bind_table(). */
+        if ( NIL_P(entry->callback) )
+        {
+            entry->callback = gtk3_accel_table_callable(entry->closure);
+        }
+    }
+
+    return entry->callback;
+}
+
 /**
  * Initializes the class and required variables.
  *
@@ -105,6 +290,11 @@ void Init_gtk3_accel_group_entry()
         rb_cObject
     );
 
+    rb_define_alloc_func(
+        gtk3_cAccelGroupEntry,
+        gtk3_accel_group_entry_allocate
+    );
+
     rb_define_method(
         gtk3_cAccelGroupEntry,
         "initialize",
@@ -112,11 +302,38 @@ void Init_gtk3_accel_group_entry()
         4
     );
 
-    rb_define_attr(gtk3_cAccelGroupEntry, "key", TRUE, FALSE);
-    rb_define_attr(gtk3_cAccelGroupEntry, "modifier", TRUE, FALSE);
-    rb_define_attr(gtk3_cAccelGroupEntry, "flags", TRUE, FALSE);
-    rb_define_attr(gtk3_cAccelGroupEntry, "path", TRUE, FALSE);
-    rb_define_attr(gtk3_cAccelGroupEntry, "callback", TRUE, FALSE);
+    rb_define_method(
+        gtk3_cAccelGroupEntry,
+        "key",
+        gtk3_accel_group_entry_key,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cAccelGroupEntry,
+        "modifier",
+        gtk3_accel_group_entry_modifier,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cAccelGroupEntry,
+        "flags",
+        gtk3_accel_group_entry_flags,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cAccelGroupEntry,
+        "path",
+        gtk3_accel_group_entry_path,
+        0
+    );
 
-    gtk3_id_accelerator_name = rb_intern("accelerator_name");
+    rb_define_method(
+        gtk3_cAccelGroupEntry,
+        "callback",
+        gtk3_accel_group_entry_callback,
+        0
+    );
 }
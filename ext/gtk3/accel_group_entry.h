@@ -3,10 +3,28 @@
 
 #include "gtk3.h"
 
-extern ID gtk3_id_accelerator_name;
+/**
+ * Structure used by {Gtk3::AccelGroupEntry}. The callback and path are
+ * retrieved when they're read for the first time, until then they're set to
+ * Qundef.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelGroupEntry
+{
+    GtkAccelKey key;
+    GClosure *closure;
+    VALUE callback;
+    VALUE path;
+} RAccelGroupEntry;
 
 extern VALUE gtk3_cAccelGroupEntry;
 
+extern VALUE gtk3_accel_group_entry_new(
+    const GtkAccelKey *key,
+    GClosure *closure
+);
+
 extern void Init_gtk3_accel_group_entry();
 
 #endif
@@ -0,0 +1,693 @@
+#include "accel_index.h"
+
+/**
+ * Document-module: Gtk3::AccelIndex
+ *
+ * {Gtk3::AccelIndex} keeps track of which accelerator groups and accelerator
+ * map paths use a key and modifier. The index is updated whenever an
+ * accelerator is connected, disconnected or changed, making it cheap to find
+ * conflicting accelerators.
+ *
+ * Accelerator groups are tracked once they're created using
+ * {Gtk3::AccelGroup.new} or otherwise passed to Ruby, for example when loaded
+ * using {Gtk3::Builder}. Groups that GTK creates and that are never passed to
+ * Ruby aren't tracked. Accelerators connected to a group using a path are only
+ * counted once, as part of the accelerator map.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_mAccelIndex;
+
+/**
+ * Hash table that maps a key and modifier to a RAccelIndexSlot.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_index_slots;
+
+/**
+ * Set of slots that have more than a single owner.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_index_conflicting;
+
+/**
+ * Set of the accelerator groups that are tracked.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_index_groups;
+
+/**
+ * Hash table that maps the quark of an accelerator map path to the slot it's
+ * currently stored in.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_index_paths;
+
+/**
+ * Hashes the key and modifier of a slot.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] data The slot to hash.
+ * @return [guint]
+ */
+static guint gtk3_accel_index_slot_hash(gconstpointer data)
+{
+    const RAccelIndexSlot *slot = data;
+
+    return slot->key ^ ((guint) slot->modifier << 16);
+}
+
+/**
+ * Returns TRUE if two slots are for the same key and modifier.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] a The first slot.
+ * @param  [gconstpointer] b The second slot.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_index_slot_equal(gconstpointer a, gconstpointer b)
+{
+    const RAccelIndexSlot *slot_a = a;
+    const RAccelIndexSlot *slot_b = b;
+
+    return slot_a->key == slot_b->key && slot_a->modifier == slot_b->modifier;
+}
+
+/**
+ * Frees a slot.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The slot to free.
+ */
+static void gtk3_accel_index_slot_free(gpointer data)
+{
+    RAccelIndexSlot *slot = (RAccelIndexSlot *) data;
+
+    g_hash_table_destroy(slot->groups);
+    g_hash_table_destroy(slot->paths);
+    g_free(slot);
+}
+
+/**
+ * Returns the slot for a key and modifier. If the slot doesn't exist it's
+ * created when `create` is set to TRUE, otherwise NULL is returned.
+ *
+ * @since  2026-10-19
+ * @param  [guint] key The accelerator key.
+ * @param  [GdkModifierType] modifier The accelerator modifier.
+ * @param  [gboolean] create Whether to create missing slots.
+ * @return [RAccelIndexSlot *]
+ */
+static RAccelIndexSlot *gtk3_accel_index_slot(
+    guint key,
+    GdkModifierType modifier,
+    gboolean create
+)
+{
+    RAccelIndexSlot query;
+    RAccelIndexSlot *slot;
+
+    query.key      = key;
+    query.modifier = modifier;
+
+    slot = g_hash_table_lookup(gtk3_accel_index_slots, &query);
+
+    if ( slot == NULL && create )
+    {
+        slot           = g_new(RAccelIndexSlot, 1);
+        slot->key      = key;
+        slot->modifier = modifier;
+        slot->total    = 0;
+        slot->groups   = g_hash_table_new(g_direct_hash, g_direct_equal);
+        slot->paths    = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+        g_hash_table_insert(gtk3_accel_index_slots, slot, slot);
+    }
+
+    return slot;
+}
+
+/**
+ * Updates the conflict set after the owners of a slot changed and removes the
+ * slot once it no longer has any owners.
+ *
+ * @since 2026-10-19
+ * @param [RAccelIndexSlot *] slot The slot that changed.
+ */
+static void gtk3_accel_index_slot_changed(RAccelIndexSlot *slot)
+{
+    if ( slot->total > 1 )
+    {
+        g_hash_table_add(gtk3_accel_index_conflicting, slot);
+    }
+    else
+    {
+        g_hash_table_remove(gtk3_accel_index_conflicting, slot);
+    }
+
+    if ( slot->total == 0 )
+    {
+        g_hash_table_remove(gtk3_accel_index_slots, slot);
+    }
+}
+
+/**
+ * Sets the amount of entries a group has for the key and modifier of a slot.
+ *
+ * @since 2026-10-19
+ * @param [RAccelIndexSlot *] slot The slot to update.
+ * @param [GtkAccelGroup *] group The accelerator group.
+ * @param [guint] amount The amount of entries.
+ */
+static void gtk3_accel_index_slot_set_group(
+    RAccelIndexSlot *slot,
+    GtkAccelGroup *group,
+    guint amount
+)
+{
+    slot->total -= GPOINTER_TO_UINT(g_hash_table_lookup(slot->groups, group));
+
+    if ( amount > 0 )
+    {
+        g_hash_table_insert(slot->groups, group, GUINT_TO_POINTER(amount));
+    }
+    else
+    {
+        g_hash_table_remove(slot->groups, group);
+    }
+
+    slot->total += amount;
+
+    gtk3_accel_index_slot_changed(slot);
+}
+
+/**
+ * Counts the entries of a group for a key and modifier and updates the
+ * index. Entries connected using a path are ignored as these are tracked as
+ * part of the accelerator map.
+ *
+ * @since 2026-10-19
+ * @param [GtkAccelGroup *] group The accelerator group.
+ * @param [guint] key The accelerator key.
+ * @param [GdkModifierType] modifier The accelerator modifier.
+ */
+static void gtk3_accel_index_count_group(
+    GtkAccelGroup *group,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    guint index;
+    guint n_entries;
+    guint amount = 0;
+    GtkAccelGroupEntry *entries;
+    RAccelIndexSlot *slot;
+
+    entries = gtk_accel_group_query(group, key, modifier, &n_entries);
+
+    for ( index = 0; index < n_entries; index++ )
+    {
+        if ( entries[index].accel_path_quark == 0 )
+        {
+            amount++;
+        }
+    }
+
+    slot = gtk3_accel_index_slot(key, modifier, amount > 0);
+
+    if ( slot != NULL )
+    {
+        gtk3_accel_index_slot_set_group(slot, group, amount);
+    }
+}
+
+/**
+ * Called whenever an accelerator of a tracked group is connected or
+ * disconnected.
+ *
+ * @since 2026-10-19
+ * @param [GtkAccelGroup *] group The accelerator group.
+ * @param [guint] key The accelerator key.
+ * @param [GdkModifierType] modifier The accelerator modifier.
+ * @param [GClosure *] closure The closure of the accelerator.
+ * @param [gpointer] data Unused.
+ */
+static void gtk3_accel_index_group_changed(
+    GtkAccelGroup *group,
+    guint key,
+    GdkModifierType modifier,
+    GClosure *closure,
+    gpointer data
+)
+{
+    gtk3_accel_index_count_group(group, key, modifier);
+}
+
+/**
+ * Called by gtk_accel_group_find() to count the existing entries of a group
+ * once it's tracked.
+ *
+ * @since  2026-10-19
+ * @param  [GtkAccelKey *] key The key, modifier and flags of the accelerator.
+ * @param  [GClosure *] closure The closure of the accelerator.
+ * @param  [gpointer] data The accelerator group.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_index_count_existing(
+    GtkAccelKey *key,
+    GClosure *closure,
+    gpointer data
+)
+{
+    gtk3_accel_index_count_group(
+        (GtkAccelGroup *) data,
+        key->accel_key,
+        key->accel_mods
+    );
+
+    return FALSE;
+}
+
+/**
+ * Removes a group from the index once it's finalized.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data Unused.
+ * @param [GObject *] group The group that was finalized.
+ */
+static void gtk3_accel_index_group_finalized(gpointer data, GObject *group)
+{
+    GHashTableIter iter;
+    gpointer slot;
+    GPtrArray *slots = g_ptr_array_new();
+    guint index;
+
+    g_hash_table_remove(gtk3_accel_index_groups, group);
+
+    g_hash_table_iter_init(&iter, gtk3_accel_index_slots);
+
+    while ( g_hash_table_iter_next(&iter, &slot, NULL) )
+    {
+        if ( g_hash_table_contains(((RAccelIndexSlot *) slot)->groups, group) )
+        {
+            g_ptr_array_add(slots, slot);
+        }
+    }
+
+    /* Slots may be removed, which can't be done while iterating over them. */
+    for ( index = 0; index < slots->len; index++ )
+    {
+        gtk3_accel_index_slot_set_group(
+            g_ptr_array_index(slots, index),
+            (GtkAccelGroup *) group,
+            0
+        );
+    }
+
+    g_ptr_array_free(slots, TRUE);
+}
+
+/**
+ * Starts tracking the accelerators of a group. Groups that are already
+ * tracked are ignored.
+ *
+ * @since 2026-10-19
+ * @param [GtkAccelGroup *] group The accelerator group to track.
+ */
+void gtk3_accel_index_track_group(GtkAccelGroup *group)
+{
+    if ( !g_hash_table_add(gtk3_accel_index_groups, group) )
+    {
+        return;
+    }
+
+    g_signal_connect(
+        group,
+        "accel-changed",
+        G_CALLBACK(gtk3_accel_index_group_changed),
+        NULL
+    );
+
+    g_object_weak_ref(G_OBJECT(group), gtk3_accel_index_group_finalized, NULL);
+
+    gtk_accel_group_find(group, gtk3_accel_index_count_existing, group);
+}
+
+/**
+ * Updates the key and modifier of an accelerator map path. A key of 0 removes
+ * the path from the index.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The accelerator path.
+ * @param [guint] key The new accelerator key.
+ * @param [GdkModifierType] modifier The new accelerator modifier.
+ */
+void gtk3_accel_index_update_path(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    GQuark quark = g_quark_from_string(path);
+    gpointer owner = GUINT_TO_POINTER(quark);
+    RAccelIndexSlot *slot;
+
+    slot = g_hash_table_lookup(gtk3_accel_index_paths, owner);
+
+    if ( slot != NULL )
+    {
+        if ( slot->key == key && slot->modifier == modifier )
+        {
+            return;
+        }
+
+        g_hash_table_remove(slot->paths, owner);
+        g_hash_table_remove(gtk3_accel_index_paths, owner);
+
+        slot->total--;
+
+        gtk3_accel_index_slot_changed(slot);
+    }
+
+    if ( key == 0 )
+    {
+        return;
+    }
+
+    slot = gtk3_accel_index_slot(key, modifier, TRUE);
+
+    g_hash_table_add(slot->paths, owner);
+    g_hash_table_insert(gtk3_accel_index_paths, owner, slot);
+
+    slot->total++;
+
+    gtk3_accel_index_slot_changed(slot);
+}
+
+/**
+ * Structure containing a copy of the owners of a slot. Ruby objects are only
+ * created after the index has been copied, as creating them may finalize
+ * groups which in turn changes the index.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelIndexCopy
+{
+    guint key;
+    GdkModifierType modifier;
+    GPtrArray *groups;
+    GArray *paths;
+} RAccelIndexCopy;
+
+/**
+ * Copies the owners of a slot, taking a reference to every group.
+ *
+ * @since  2026-10-19
+ * @param  [RAccelIndexSlot *] slot The slot to copy.
+ * @return [RAccelIndexCopy *]
+ */
+static RAccelIndexCopy *gtk3_accel_index_copy_new(RAccelIndexSlot *slot)
+{
+    GHashTableIter iter;
+    gpointer owner;
+    GQuark quark;
+    RAccelIndexCopy *copy = g_new(RAccelIndexCopy, 1);
+
+    copy->key      = slot->key;
+    copy->modifier = slot->modifier;
+    copy->groups   = g_ptr_array_new_with_free_func(g_object_unref);
+    copy->paths    = g_array_new(FALSE, FALSE, sizeof(GQuark));
+
+    g_hash_table_iter_init(&iter, slot->groups);
+
+    while ( g_hash_table_iter_next(&iter, &owner, NULL) )
+    {
+        g_ptr_array_add(copy->groups, g_object_ref(owner));
+    }
+
+    g_hash_table_iter_init(&iter, slot->paths);
+
+    while ( g_hash_table_iter_next(&iter, &owner, NULL) )
+    {
+        quark = GPOINTER_TO_UINT(owner);
+
+        g_array_append_val(copy->paths, quark);
+    }
+
+    return copy;
+}
+
+/**
+ * Frees a copy of a slot.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The copy to free.
+ */
+static void gtk3_accel_index_copy_free(gpointer data)
+{
+    RAccelIndexCopy *copy = (RAccelIndexCopy *) data;
+
+    g_ptr_array_free(copy->groups, TRUE);
+    g_array_free(copy->paths, TRUE);
+    g_free(copy);
+}
+
+/**
+ * Returns the owners of a copied slot as an Array containing accelerator
+ * groups and accelerator map paths.
+ *
+ * @since  2026-10-19
+ * @param  [RAccelIndexCopy *] copy The copy of the slot.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_index_copy_owners(RAccelIndexCopy *copy)
+{
+    guint index;
+    gpointer group;
+    VALUE owners = rb_ary_new2(copy->groups->len + copy->paths->len);
+
+    for ( index = 0; index < copy->groups->len; index++ )
+    {
+        group = g_ptr_array_index(copy->groups, index);
+
+        rb_ary_push(owners, gtk3_object_wrap(Qnil, group, FALSE));
+    }
+
+    for ( index = 0; index < copy->paths->len; index++ )
+    {
+        rb_ary_push(
+            owners,
+            gtk3_utf8_intern(
+                g_quark_to_string(g_array_index(copy->paths, GQuark, index))
+            )
+        );
+    }
+
+    return owners;
+}
+
+/**
+ * Creates the Array returned by {Gtk3::AccelIndex.conflicts}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data GPtrArray containing copies of the slots.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_index_build_conflicts(VALUE data)
+{
+    guint index;
+    VALUE conflicts;
+    RAccelIndexCopy *copy;
+    GPtrArray *copies = (GPtrArray *) data;
+
+    conflicts = rb_ary_new2(copies->len);
+
+    for ( index = 0; index < copies->len; index++ )
+    {
+        copy = g_ptr_array_index(copies, index);
+
+        rb_ary_push(
+            conflicts,
+            rb_ary_new3(
+                3,
+                UINT2NUM(copy->key),
+                UINT2NUM(copy->modifier),
+                gtk3_accel_index_copy_owners(copy)
+            )
+        );
+    }
+
+    return conflicts;
+}
+
+/**
+ * Frees the copies of the slots used by {Gtk3::AccelIndex.conflicts} and
+ * {Gtk3::AccelIndex.owners}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data GPtrArray containing copies of the slots.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_index_free_copies(VALUE data)
+{
+    g_ptr_array_free((GPtrArray *) data, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Returns all the keys and modifiers that are used by more than a single
+ * accelerator. Each conflict is an Array containing the key, the modifier
+ * and the owners of the accelerator. Owners are instances of
+ * {Gtk3::AccelGroup} and accelerator map paths. A group is listed once, even
+ * when it contains multiple entries for the same key and modifier.
+ *
+ * Only the conflicting accelerators are visited, the time this method takes
+ * doesn't depend on the total amount of accelerators.
+ *
+ * @example
+ *  Gtk3::AccelIndex.conflicts
+ *  # => [[113, 4, [#<Gtk3::AccelGroup ...>, "<App>/File/Quit"]]]
+ *
+ * @since  2026-10-19
+ * @return [Array]
+ */
+static VALUE gtk3_accel_index_get_conflicts(VALUE self)
+{
+    GHashTableIter iter;
+    gpointer slot;
+    GPtrArray *copies;
+
+    copies = g_ptr_array_new_with_free_func(gtk3_accel_index_copy_free);
+
+    g_hash_table_iter_init(&iter, gtk3_accel_index_conflicting);
+
+    while ( g_hash_table_iter_next(&iter, &slot, NULL) )
+    {
+        g_ptr_array_add(copies, gtk3_accel_index_copy_new(slot));
+    }
+
+    return rb_ensure(
+        gtk3_accel_index_build_conflicts,
+        (VALUE) copies,
+        gtk3_accel_index_free_copies,
+        (VALUE) copies
+    );
+}
+
+/**
+ * Creates the Array returned by {Gtk3::AccelIndex.owners}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data GPtrArray containing a copy of a slot.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_index_build_owners(VALUE data)
+{
+    return gtk3_accel_index_copy_owners(
+        g_ptr_array_index((GPtrArray *) data, 0)
+    );
+}
+
+/**
+ * Returns the owners of a key and modifier.
+ *
+ * @example
+ *  Gtk3::AccelIndex.owners(:q, :control) # => ["<App>/File/Quit"]
+ *
+ * @since  2026-10-19
+ * @param  [Fixnum|Bignum|String|Symbol] key The accelerator key.
+ * @param  [Fixnum|Bignum|String|Symbol] modifier The accelerator modifier.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_index_get_owners(VALUE self, VALUE key, VALUE modifier)
+{
+    GPtrArray *copies;
+    RAccelIndexSlot *slot;
+
+    key      = gtk3_lookup_accelerator_key(key);
+    modifier = gtk3_lookup_accelerator_modifier(modifier);
+    slot     = gtk3_accel_index_slot(NUM2UINT(key), NUM2UINT(modifier), FALSE);
+
+    if ( slot == NULL )
+    {
+        return rb_ary_new();
+    }
+
+    copies = g_ptr_array_new_with_free_func(gtk3_accel_index_copy_free);
+
+    g_ptr_array_add(copies, gtk3_accel_index_copy_new(slot));
+
+    return rb_ensure(
+        gtk3_accel_index_build_owners,
+        (VALUE) copies,
+        gtk3_accel_index_free_copies,
+        (VALUE) copies
+    );
+}
+
+/**
+ * Called for every existing accelerator map entry when the index is set up.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data Unused.
+ * @param [const gchar *] path The accelerator path.
+ * @param [guint] key The accelerator key.
+ * @param [GdkModifierType] modifier The accelerator modifier.
+ * @param [gboolean] changed Unused.
+ */
+static void gtk3_accel_index_add_existing(
+    gpointer data,
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+)
+{
+    gtk3_accel_index_update_path(path, key, modifier);
+}
+
+/**
+ * Sets up the index and the {Gtk3::AccelIndex} module.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_index()
+{
+    gtk3_accel_index_slots = g_hash_table_new_full(
+        gtk3_accel_index_slot_hash,
+        gtk3_accel_index_slot_equal,
+        NULL,
+        gtk3_accel_index_slot_free
+    );
+
+    gtk3_accel_index_conflicting = g_hash_table_new(
+        g_direct_hash,
+        g_direct_equal
+    );
+
+    gtk3_accel_index_groups = g_hash_table_new(g_direct_hash, g_direct_equal);
+    gtk3_accel_index_paths  = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk_accel_map_foreach_unfiltered(NULL, gtk3_accel_index_add_existing);
+
+    gtk3_mAccelIndex = rb_define_module_under(gtk3_mGtk3, "AccelIndex");
+
+    rb_define_singleton_method(
+        gtk3_mAccelIndex,
+        "conflicts",
+        gtk3_accel_index_get_conflicts,
+        0
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelIndex,
+        "owners",
+        gtk3_accel_index_get_owners,
+        2
+    );
+}
@@ -0,0 +1,38 @@
+#ifndef GTK3_ACCEL_INDEX
+#define GTK3_ACCEL_INDEX
+
+#include "gtk3.h"
+
+/**
+ * Structure containing the owners of a single key and modifier.
+ *
+ * * key: the accelerator key.
+ * * modifier: the accelerator modifier.
+ * * groups: hash table of accelerator groups and their amount of entries.
+ * * paths: set of the quarks of accelerator map paths.
+ * * total: the total amount of owners.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelIndexSlot
+{
+    guint key;
+    GdkModifierType modifier;
+    GHashTable *groups;
+    GHashTable *paths;
+    guint total;
+} RAccelIndexSlot;
+
+extern VALUE gtk3_mAccelIndex;
+
+extern void gtk3_accel_index_track_group(GtkAccelGroup *group);
+
+extern void gtk3_accel_index_update_path(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+);
+
+extern void Init_gtk3_accel_index();
+
+#endif
@@ -0,0 +1,388 @@
+#include "accel_journal.h"
+#include <errno.h>
+
+/**
+ * The state of the accelerator journal. There's only a single accelerator
+ * map, thus there's only a single journal.
+ *
+ * @since 2026-10-19
+ */
+static RAccelJournal gtk3_accel_journal;
+
+/* Helper methods */
+
+/**
+ * Writes the full accelerator map to the base file and truncates the journal.
+ * The base file is replaced atomically and is written before the journal is
+ * truncated, so an interrupted compaction at worst replays changes that are
+ * already part of the base file.
+ *
+ * @since  2026-10-19
+ * @param  [GError **] error Location to store an error in.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_journal_compact(GError **error)
+{
+    gchar *dump      = gtk3_accel_map_dump();
+    gboolean written = g_file_set_contents(
+        gtk3_accel_journal.base_path,
+        dump,
+        -1,
+        error
+    );
+
+    g_free(dump);
+
+    if ( !written )
+    {
+        return FALSE;
+    }
+
+    gtk3_accel_journal.file = freopen(
+        gtk3_accel_journal.journal_path,
+        "w",
+        gtk3_accel_journal.file
+    );
+
+    if ( !gtk3_accel_journal.file )
+    {
+        g_set_error(
+            error,
+            G_FILE_ERROR,
+            g_file_error_from_errno(errno),
+            "Failed to truncate %s: %s",
+            gtk3_accel_journal.journal_path,
+            g_strerror(errno)
+        );
+
+        return FALSE;
+    }
+
+    gtk3_accel_journal.changes = 0;
+
+    return TRUE;
+}
+
+/**
+ * Closes the journal file and releases the paths of the journal.
+ *
+ * @since 2026-10-19
+ */
+static void gtk3_accel_journal_release()
+{
+    if ( gtk3_accel_journal.file )
+    {
+        fclose(gtk3_accel_journal.file);
+    }
+
+    g_free(gtk3_accel_journal.base_path);
+    g_free(gtk3_accel_journal.journal_path);
+
+    gtk3_accel_journal.file         = NULL;
+    gtk3_accel_journal.base_path    = NULL;
+    gtk3_accel_journal.journal_path = NULL;
+    gtk3_accel_journal.changes      = 0;
+}
+
+/**
+ * Loads the accelerator specifications of a file if it exists.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The path of the file to load.
+ */
+static void gtk3_accel_journal_replay_file(const gchar *path)
+{
+    gchar *contents;
+    gsize length;
+
+    if ( g_file_get_contents(path, &contents, &length, NULL) )
+    {
+        gtk3_accel_map_load_text(contents, length);
+
+        g_free(contents);
+    }
+}
+
+/**
+ * Loads the base file and replays the journal on top of it. Changes made
+ * while replaying aren't recorded.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] base_path The path of the base file.
+ * @param [const gchar *] journal_path The path of the journal.
+ */
+static void gtk3_accel_journal_replay(
+    const gchar *base_path,
+    const gchar *journal_path
+)
+{
+    gtk3_accel_journal.loading = TRUE;
+
+    gtk3_accel_journal_replay_file(base_path);
+    gtk3_accel_journal_replay_file(journal_path);
+
+    gtk3_accel_journal.loading = FALSE;
+}
+
+/**
+ * Appends a changed accelerator map entry to the journal, if the journal is
+ * open. Once enough changes have been recorded the journal is compacted.
+ * This function is called from signal handlers and thus only emits a warning
+ * when compacting fails, the changes are kept in the journal in that case.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The accelerator path of the entry.
+ * @param [guint] key The new accelerator key of the entry.
+ * @param [GdkModifierType] modifier The new accelerator modifier.
+ */
+void gtk3_accel_journal_record(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    GString *line;
+    GError *error = NULL;
+
+    if ( !gtk3_accel_journal.file || gtk3_accel_journal.loading )
+    {
+        return;
+    }
+
+    line = g_string_new(NULL);
+
+    gtk3_accel_map_dump_entry(line, path, key, modifier, TRUE);
+
+    fputs(line->str, gtk3_accel_journal.file);
+    fflush(gtk3_accel_journal.file);
+
+    g_string_free(line, TRUE);
+
+    gtk3_accel_journal.changes++;
+
+    if ( gtk3_accel_journal.compact_after > 0
+    && gtk3_accel_journal.changes >= gtk3_accel_journal.compact_after
+    && !gtk3_accel_journal_compact(&error) )
+    {
+        g_warning(
+            "Failed to compact the accelerator journal: %s",
+            error->message
+        );
+
+        g_error_free(error);
+
+        if ( !gtk3_accel_journal.file )
+        {
+            gtk3_accel_journal_release();
+        }
+    }
+}
+
+/* Class methods */
+
+/**
+ * Loads the accelerator map from a base file and replays the changes stored
+ * in its journal (the base path followed by `.journal`). Missing files are
+ * ignored.
+ *
+ * @example
+ *  Gtk3::AccelMap.load_journal('keymap.rc')
+ *
+ * @since 2026-10-19
+ * @param [String] path The path of the base file.
+ */
+static VALUE gtk3_accel_journal_load(VALUE class, VALUE path)
+{
+    gchar *journal_path;
+
+    Check_Type(path, T_STRING);
+
+    journal_path = g_strconcat(StringValueCStr(path), ".journal", NULL);
+
+    gtk3_accel_journal_replay(StringValueCStr(path), journal_path);
+
+    g_free(journal_path);
+
+    return Qnil;
+}
+
+/**
+ * Loads the accelerator map from a base file and its journal and starts
+ * recording changes to the map in the journal. Every change is appended to
+ * the journal as a single line, after the given amount of changes the full
+ * map is written to the base file and the journal is truncated.
+ *
+ * @example
+ *  Gtk3::AccelMap.open_journal('keymap.rc')
+ *
+ *  Gtk3::AccelMap.change_entry('<App>/Quit', 113, :control, true)
+ *
+ *  Gtk3::AccelMap.close_journal
+ *
+ * @since 2026-10-19
+ * @param [String] path The path of the base file.
+ * @param [Fixnum] compact_after The amount of changes after which the journal
+ *  is compacted, 0 disables automatic compaction. Defaults to 1000.
+ */
+static VALUE gtk3_accel_journal_open(int argc, VALUE *argv, VALUE class)
+{
+    VALUE path;
+    VALUE compact_after;
+    VALUE rb_journal_path;
+    gchar *journal_path;
+    FILE *file;
+
+    rb_scan_args(argc, argv, "11", &path, &compact_after);
+
+    Check_Type(path, T_STRING);
+
+    if ( gtk3_accel_journal.file )
+    {
+        rb_raise(rb_eRuntimeError, "the accelerator journal is already open");
+    }
+
+    gtk3_accel_journal.compact_after = NIL_P(compact_after)
+        ? 1000 : NUM2UINT(compact_after);
+
+    journal_path = g_strconcat(StringValueCStr(path), ".journal", NULL);
+
+    gtk3_accel_journal_replay(StringValueCStr(path), journal_path);
+
+    rb_journal_path = rb_str_new2(journal_path);
+    file            = fopen(journal_path, "a");
+
+    if ( !file )
+    {
+        g_free(journal_path);
+
+        rb_sys_fail(StringValueCStr(rb_journal_path));
+    }
+
+    gtk3_accel_journal.file         = file;
+    gtk3_accel_journal.base_path    = g_strdup(StringValueCStr(path));
+    gtk3_accel_journal.journal_path = journal_path;
+    gtk3_accel_journal.changes      = 0;
+
+    return Qnil;
+}
+
+/**
+ * Writes the full accelerator map to the base file and truncates the journal.
+ *
+ * @since 2026-10-19
+ * @raise [IOError] Raised when the base file couldn't be written.
+ */
+static VALUE gtk3_accel_journal_compact_map(VALUE class)
+{
+    GError *error = NULL;
+    VALUE exception;
+
+    if ( !gtk3_accel_journal.file )
+    {
+        rb_raise(rb_eRuntimeError, "the accelerator journal isn't open");
+    }
+
+    if ( !gtk3_accel_journal_compact(&error) )
+    {
+        exception = rb_exc_new2(rb_eIOError, error->message);
+
+        g_error_free(error);
+
+        /* The journal can't be appended to if it couldn't be reopened. */
+        if ( !gtk3_accel_journal.file )
+        {
+            gtk3_accel_journal_release();
+        }
+
+        rb_exc_raise(exception);
+    }
+
+    return Qnil;
+}
+
+/**
+ * Compacts the journal and stops recording changes. Does nothing if the
+ * journal isn't open.
+ *
+ * @since 2026-10-19
+ * @raise [IOError] Raised when the base file couldn't be written, the journal
+ *  is closed regardless.
+ */
+static VALUE gtk3_accel_journal_close(VALUE class)
+{
+    GError *error = NULL;
+    VALUE exception;
+
+    if ( !gtk3_accel_journal.file )
+    {
+        return Qnil;
+    }
+
+    if ( !gtk3_accel_journal_compact(&error) )
+    {
+        exception = rb_exc_new2(rb_eIOError, error->message);
+
+        g_error_free(error);
+        gtk3_accel_journal_release();
+
+        rb_exc_raise(exception);
+    }
+
+    gtk3_accel_journal_release();
+
+    return Qnil;
+}
+
+/**
+ * Returns `true` if changes to the accelerator map are recorded.
+ *
+ * @since  2026-10-19
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_accel_journal_open_p(VALUE class)
+{
+    return gtk3_accel_journal.file ? Qtrue : Qfalse;
+}
+
+/**
+ * Initializes the journal methods of {Gtk3::AccelMap}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_journal()
+{
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "load_journal",
+        gtk3_accel_journal_load,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "open_journal",
+        gtk3_accel_journal_open,
+        -1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "compact_journal",
+        gtk3_accel_journal_compact_map,
+        0
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "close_journal",
+        gtk3_accel_journal_close,
+        0
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "journal_open?",
+        gtk3_accel_journal_open_p,
+        0
+    );
+}
@@ -0,0 +1,38 @@
+#ifndef GTK3_ACCEL_JOURNAL
+#define GTK3_ACCEL_JOURNAL
+
+#include "gtk3.h"
+
+/**
+ * Structure containing the state of the accelerator journal.
+ *
+ * * base_path: the path of the file containing the full accelerator map.
+ * * journal_path: the path of the file the changes are appended to.
+ * * file: the opened journal file, NULL when the journal isn't open.
+ * * changes: the amount of changes written since the last compaction.
+ * * compact_after: the amount of changes after which the journal is
+ *   compacted, 0 disables automatic compaction.
+ * * loading: set while the journal is replayed so that the replayed changes
+ *   aren't recorded again.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelJournal
+{
+    gchar *base_path;
+    gchar *journal_path;
+    FILE *file;
+    guint changes;
+    guint compact_after;
+    gboolean loading;
+} RAccelJournal;
+
+extern void gtk3_accel_journal_record(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+);
+
+extern void Init_gtk3_accel_journal();
+
+#endif
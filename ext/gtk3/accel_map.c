@@ -56,8 +56,129 @@
  */
 VALUE gtk3_mAccelMap;
 
+/**
+ * Hash table that maps the quarks of accelerator paths to frozen Strings.
+ * Accelerator paths are never removed so neither are these Strings.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_map_paths;
+
+/**
+ * Hidden Ruby object that marks the Strings in gtk3_accel_map_paths.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_accel_map_paths_keeper;
+
+/**
+ * ID for the `:changed_only` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_changed_only;
+
+/**
+ * ID for the `:read` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_read;
+
+/**
+ * ID for the `:write` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_write;
+
+/**
+ * Structure used for a parsed entry of the Hash passed to
+ * {Gtk3::AccelMap.import}.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelMapItem
+{
+    const gchar *path;
+    guint key;
+    GdkModifierType modifier;
+    gboolean changed;
+} RAccelMapItem;
+
+/**
+ * Structure used for a pending call to {Gtk3::AccelMap.save_async}. Apart
+ * from the callback this structure only contains native data so that it can
+ * be used by the worker thread without holding the GVL.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelMapSave
+{
+    gchar *path;
+    gchar *contents;
+    GError *error;
+    VALUE callback;
+} RAccelMapSave;
+
+/**
+ * Set of RAccelMapSave structures for saves that haven't completed yet.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_map_saves;
+
+/**
+ * Hidden Ruby object that marks the callbacks in gtk3_accel_map_saves.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_accel_map_saves_keeper;
+
 /* Helper methods */
 
+/**
+ * Marks the Strings in gtk3_accel_map_paths.
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_accel_map_paths_mark(void *data)
+{
+    GHashTableIter iter;
+    gpointer path;
+
+    g_hash_table_iter_init(&iter, gtk3_accel_map_paths);
+
+    while ( g_hash_table_iter_next(&iter, NULL, &path) )
+    {
+        rb_gc_mark((VALUE) path);
+    }
+}
+
+/**
+ * Returns a frozen String for an accelerator path. The same String is returned
+ * every time the path is used.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] path The accelerator path.
+ * @return [String]
+ */
+VALUE gtk3_accel_map_path_string(const gchar *path)
+{
+    gpointer quark = GUINT_TO_POINTER(g_quark_from_string(path));
+    VALUE string   = (VALUE) g_hash_table_lookup(gtk3_accel_map_paths, quark);
+
+    if ( !string )
+    {
+        string = rb_obj_freeze(gtk3_utf8_new(path));
+
+        g_hash_table_insert(gtk3_accel_map_paths, quark, (gpointer) string);
+    }
+
+    return string;
+}
+
 /**
  * Function that is called for each accelerator map entry when using
  * {Gtk3::AccelMap.foreach}.
@@ -79,7 +200,7 @@ void gtk3_accel_map_foreach_callback(
 )
 {
     VALUE proc       = (VALUE) data;
-    VALUE rb_path    = rb_str_new2(path);
+    VALUE rb_path    = gtk3_utf8_new(path);
     VALUE rb_key     = INT2NUM(key);
     VALUE rb_mod     = INT2NUM(modifier);
     VALUE rb_changed = gtk3_gboolean_to_rboolean(changed);
@@ -87,6 +208,61 @@ void gtk3_accel_map_foreach_callback(
     rb_funcall(proc, gtk3_id_call, 4, rb_path, rb_key, rb_mod, rb_changed);
 }
 
+/**
+ * Called whenever an accelerator map entry is added or changed. This is the
+ * single place that keeps the native indexes of accelerator map entries up to
+ * date.
+ *
+ * Entries registered using {Gtk3::AccelMap.add_entry} are usually defaults
+ * that are added every time an application starts. These only update the
+ * indexes, only actual changes are journaled and passed to the handlers of
+ * {Gtk3::AccelMap.on\_changed}.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The accelerator path of the entry.
+ * @param [guint] key The accelerator key of the entry.
+ * @param [GdkModifierType] modifier The accelerator modifier of the entry.
+ * @param [gboolean] changed Whether the entry was changed rather than
+ *  registered.
+ */
+static void gtk3_accel_map_entry_changed(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+)
+{
+    gtk3_accel_index_update_path(path, key, modifier);
+    gtk3_accel_search_update(path, key, modifier);
+
+    if ( changed )
+    {
+        gtk3_accel_journal_record(path, key, modifier);
+        gtk3_accel_notify_record(path);
+    }
+}
+
+/**
+ * Handler for the "changed" signal of the accelerator map.
+ *
+ * @since 2026-10-19
+ * @param [GtkAccelMap *] map The accelerator map.
+ * @param [gchar *] path The accelerator path of the entry.
+ * @param [guint] key The accelerator key of the entry.
+ * @param [GdkModifierType] modifier The accelerator modifier of the entry.
+ * @param [gpointer] data Unused.
+ */
+static void gtk3_accel_map_changed(
+    GtkAccelMap *map,
+    gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gpointer data
+)
+{
+    gtk3_accel_map_entry_changed(path, key, modifier, TRUE);
+}
+
 /* Class methods */
 
 /**
@@ -110,16 +286,34 @@ static VALUE gtk3_accel_map_add_entry(
     const gchar *gtk_path;
     guint gtk_key;
     GdkModifierType gdk_modifier;
+    GtkAccelKey gtk_accel_key;
 
     Check_Type(path, T_STRING);
     gtk3_check_number(key);
 
     gdk_modifier = NUM2INT(gtk3_lookup_accelerator_modifier(modifier));
-    gtk_path     = StringValuePtr(path);
+    gtk_path     = gtk3_string_value_utf8(&path);
     gtk_key      = NUM2INT(key);
 
+    /* GTK leaves existing entries untouched, there's nothing to update. */
+    if ( gtk_accel_map_lookup_entry(gtk_path, &gtk_accel_key) )
+    {
+        return Qnil;
+    }
+
     gtk_accel_map_add_entry(gtk_path, gtk_key, gdk_modifier);
 
+    /* GTK doesn't emit "changed" for new entries. */
+    if ( gtk_accel_map_lookup_entry(gtk_path, &gtk_accel_key) )
+    {
+        gtk3_accel_map_entry_changed(
+            gtk_path,
+            gtk_accel_key.accel_key,
+            gtk_accel_key.accel_mods,
+            FALSE
+        );
+    }
+
     return Qnil;
 }
 
@@ -146,7 +340,7 @@ static VALUE gtk3_accel_map_lookup_entry(VALUE class, VALUE path)
 
     Check_Type(path, T_STRING);
 
-    gtk_path = StringValuePtr(path);
+    gtk_path = gtk3_string_value_utf8(&path);
 
     if ( gtk_accel_map_lookup_entry(gtk_path, &gtk_key) == TRUE )
     {
@@ -199,7 +393,7 @@ static VALUE gtk3_accel_map_change_entry(int argc, VALUE *argv, VALUE self)
     gtk3_check_number(argv[1]);
 
     gdk_modifier = NUM2INT(gtk3_lookup_accelerator_modifier(argv[2]));
-    gtk_path     = StringValuePtr(argv[0]);
+    gtk_path     = gtk3_string_value_utf8(&argv[0]);
     gtk_key      = NUM2INT(argv[1]);
     gtk_replace  = FALSE;
 
@@ -250,6 +444,278 @@ static VALUE gtk3_accel_map_load(VALUE self, VALUE path)
     return Qnil;
 }
 
+/**
+ * Called by gtk_accel_map_foreach() for every entry written by
+ * gtk3_accel_map_dump(). Entries are written in the same format as
+ * gtk_accel_map_save(): entries that weren't changed at runtime are commented
+ * out. This function is also used to write single entries to the accelerator
+ * journal.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The GString to write the entry to.
+ * @param [const gchar *] path The accelerator path of the entry.
+ * @param [guint] key The accelerator key of the entry.
+ * @param [GdkModifierType] modifier The modifier of the entry.
+ * @param [gboolean] changed Whether the entry was changed at runtime.
+ */
+void gtk3_accel_map_dump_entry(
+    gpointer data,
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+)
+{
+    gchar *name         = gtk_accelerator_name(key, modifier);
+    gchar *escaped_path = g_strescape(path, NULL);
+    gchar *escaped_name = g_strescape(name, NULL);
+
+    g_string_append_printf(
+        (GString *) data,
+        "%s(gtk_accel_path \"%s\" \"%s\")\n",
+        changed ? "" : "; ",
+        escaped_path,
+        escaped_name
+    );
+
+    g_free(escaped_name);
+    g_free(escaped_path);
+    g_free(name);
+}
+
+/**
+ * Returns the accelerator map in the format used by gtk_accel_map_save().
+ * The returned string must be freed using g_free(). This function doesn't
+ * call into Ruby and can be used to snapshot the map before writing it
+ * elsewhere.
+ *
+ * @since  2026-10-19
+ * @return [gchar *]
+ */
+gchar *gtk3_accel_map_dump()
+{
+    GString *output = g_string_new(NULL);
+
+    g_string_append_printf(
+        output,
+        "; %s GtkAccelMap rc-file         -*- scheme -*-\n"
+        "; this file is an automated accelerator map dump\n"
+        ";\n",
+        g_get_prgname() ? g_get_prgname() : ""
+    );
+
+    gtk_accel_map_foreach(output, gtk3_accel_map_dump_entry);
+
+    return g_string_free(output, FALSE);
+}
+
+/**
+ * Parses accelerator specifications in the format used by
+ * gtk_accel_map_save() in a single pass.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] text The specifications to parse.
+ * @param [gsize] length The length of the text.
+ */
+void gtk3_accel_map_load_text(const gchar *text, gsize length)
+{
+    GScanner *scanner = g_scanner_new(NULL);
+
+    g_scanner_input_text(scanner, text, length);
+
+    gtk_accel_map_load_scanner(scanner);
+
+    g_scanner_destroy(scanner);
+}
+
+/**
+ * Returns the accelerator map as a String in the same format as
+ * {Gtk3::AccelMap.save}, without writing anything to disk.
+ *
+ * @example
+ *  settings[:keymap] = Gtk3::AccelMap.dump
+ *
+ * @since  2026-10-19
+ * @return [String]
+ */
+static VALUE gtk3_accel_map_dump_string(VALUE self)
+{
+    gchar *dump  = gtk3_accel_map_dump();
+    VALUE string = gtk3_utf8_new(dump);
+
+    g_free(dump);
+
+    return string;
+}
+
+/**
+ * Loads accelerator specifications from a String, such as one returned by
+ * {Gtk3::AccelMap.dump}.
+ *
+ * @example
+ *  Gtk3::AccelMap.load_string('(gtk_accel_path "<App>/Quit" "<Control>q")')
+ *
+ * @since 2026-10-19
+ * @param [String] specifications The specifications to load.
+ */
+static VALUE gtk3_accel_map_load_string(VALUE self, VALUE specifications)
+{
+    const gchar *text = gtk3_string_value_utf8(&specifications);
+
+    gtk3_accel_map_load_text(text, RSTRING_LEN(specifications));
+
+    return Qnil;
+}
+
+/**
+ * Loads accelerator specifications by reading the given IO until its end.
+ *
+ * @since 2026-10-19
+ * @param [IO|StringIO] io The IO to read the specifications from.
+ */
+static VALUE gtk3_accel_map_load_io(VALUE self, VALUE io)
+{
+    VALUE specifications = rb_funcall(io, gtk3_id_read, 0);
+
+    if ( NIL_P(specifications) )
+    {
+        return Qnil;
+    }
+
+    return gtk3_accel_map_load_string(self, specifications);
+}
+
+/**
+ * Writes the accelerator map to the given IO.
+ *
+ * @since  2026-10-19
+ * @param  [IO|StringIO] io The IO to write the specifications to.
+ * @return [IO|StringIO]
+ */
+static VALUE gtk3_accel_map_save_io(VALUE self, VALUE io)
+{
+    rb_funcall(io, gtk3_id_write, 1, gtk3_accel_map_dump_string(self));
+
+    return io;
+}
+
+/**
+ * Marks the callbacks of the saves in gtk3_accel_map_saves.
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_accel_map_saves_mark(void *data)
+{
+    GHashTableIter iter;
+    gpointer save;
+
+    g_hash_table_iter_init(&iter, gtk3_accel_map_saves);
+
+    while ( g_hash_table_iter_next(&iter, &save, NULL) )
+    {
+        rb_gc_mark(((RAccelMapSave *) save)->callback);
+    }
+}
+
+/**
+ * Called by the main loop once a save started by {Gtk3::AccelMap.save_async}
+ * has completed. The save is released before the callback is executed. The
+ * callback can't raise through the main loop, exceptions are raised again by
+ * {Gtk3.main} or {Gtk3.main\_iteration} instead.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data The RAccelMapSave of the save.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_map_save_done(gpointer data)
+{
+    RAccelMapSave *save = (RAccelMapSave *) data;
+    VALUE callback      = save->callback;
+    VALUE result        = Qtrue;
+
+    if ( save->error )
+    {
+        result = gtk3_error_exception(save->error);
+    }
+
+    g_hash_table_remove(gtk3_accel_map_saves, save);
+
+    g_free(save->contents);
+    g_free(save->path);
+    g_free(save);
+
+    if ( !NIL_P(callback) )
+    {
+        gtk3_call_protected(callback, result);
+    }
+
+    return FALSE;
+}
+
+/**
+ * Writes the snapshot of a save started by {Gtk3::AccelMap.save_async}. This
+ * function runs in a separate thread and doesn't touch any Ruby objects.
+ * g_file_set_contents() writes to a temporary file that is renamed to the
+ * target path, thus readers never see a partially written map.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data The RAccelMapSave of the save.
+ * @return [gpointer]
+ */
+static gpointer gtk3_accel_map_save_write(gpointer data)
+{
+    RAccelMapSave *save = (RAccelMapSave *) data;
+
+    g_file_set_contents(save->path, save->contents, -1, &save->error);
+
+    g_idle_add(gtk3_accel_map_save_done, save);
+
+    return NULL;
+}
+
+/**
+ * Saves the accelerator map to the given file without blocking the main loop.
+ * The map is copied right away, the file is written in a separate thread.
+ * Once done the block is called from the main loop with `true` or an IOError
+ * describing why the file couldn't be written. Exceptions raised by the block
+ * are raised by {Gtk3.main} or {Gtk3.main\_iteration}.
+ *
+ * @example
+ *  Gtk3::AccelMap.save_async('keymap.rc') do |result|
+ *    warn(result.message) if result.is_a?(IOError)
+ *  end
+ *
+ * @since 2026-10-19
+ * @param [String] path The path of the file to write the map to.
+ * @yieldparam [TrueClass|IOError] result
+ */
+static VALUE gtk3_accel_map_save_async(VALUE self, VALUE path)
+{
+    RAccelMapSave *save;
+    GThread *thread;
+
+    Check_Type(path, T_STRING);
+
+    save = g_new0(RAccelMapSave, 1);
+
+    save->path     = g_strdup(StringValueCStr(path));
+    save->contents = gtk3_accel_map_dump();
+    save->callback = rb_block_given_p() ? rb_block_proc() : Qnil;
+
+    g_hash_table_add(gtk3_accel_map_saves, save);
+
+    thread = g_thread_new(
+        "gtk3-accel-map-save",
+        gtk3_accel_map_save_write,
+        save
+    );
+
+    g_thread_unref(thread);
+
+    return Qnil;
+}
+
 /**
  * Loops through the entries in the accelerator map and executes the specified
  * block for each unfiltered entry. See {Gtk3::AccelMap.add\_filter} for adding
@@ -299,7 +765,7 @@ static VALUE gtk3_accel_map_add_filter(VALUE self, VALUE filter)
 {
     Check_Type(filter, T_STRING);
 
-    gtk_accel_map_add_filter(StringValuePtr(filter));
+    gtk_accel_map_add_filter(gtk3_string_value_utf8(&filter));
 
     return Qnil;
 }
@@ -315,7 +781,7 @@ static VALUE gtk3_accel_map_lock_path(VALUE self, VALUE path)
 {
     Check_Type(path, T_STRING);
 
-    gtk_accel_map_lock_path(StringValuePtr(path));
+    gtk_accel_map_lock_path(gtk3_string_value_utf8(&path));
 
     return Qnil;
 }
@@ -330,11 +796,310 @@ static VALUE gtk3_accel_map_unlock_path(VALUE self, VALUE path)
 {
     Check_Type(path, T_STRING);
 
-    gtk_accel_map_unlock_path(StringValuePtr(path));
+    gtk_accel_map_unlock_path(gtk3_string_value_utf8(&path));
 
     return Qnil;
 }
 
+/**
+ * Called for every pair of the Hash passed to {Gtk3::AccelMap.import}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] path The accelerator path.
+ * @param  [VALUE] accel The accelerator as a String or an Array containing
+ *  the key and modifier.
+ * @param  [VALUE] data Array containing the GArray of items and an Array
+ *  used for keeping the paths alive.
+ * @return [int]
+ */
+static int gtk3_accel_map_import_item(VALUE path, VALUE accel, VALUE data)
+{
+    VALUE key;
+    VALUE modifier;
+    RAccelMapItem item;
+    VALUE *args = (VALUE *) data;
+
+    item.path    = gtk3_string_value_utf8(&path);
+    item.changed = FALSE;
+
+    rb_ary_push(args[1], path);
+
+    if ( TYPE(accel) == T_STRING )
+    {
+        gtk_accelerator_parse(
+            gtk3_string_value_utf8(&accel),
+            &item.key,
+            &item.modifier
+        );
+
+        if ( item.key == 0 )
+        {
+            rb_raise(
+                rb_eArgError,
+                "invalid accelerator %s",
+                RSTRING_PTR(accel)
+            );
+        }
+    }
+    else if ( TYPE(accel) == T_ARRAY && RARRAY_LEN(accel) == 2 )
+    {
+        key      = rb_ary_entry(accel, 0);
+        modifier = rb_ary_entry(accel, 1);
+
+        /* Numbers are used as-is, skipping the constant lookups. */
+        if ( !FIXNUM_P(key) )
+        {
+            key = gtk3_lookup_accelerator_key(key);
+        }
+
+        if ( !FIXNUM_P(modifier) )
+        {
+            modifier = gtk3_lookup_accelerator_modifier(modifier);
+        }
+
+        item.key      = NUM2UINT(key);
+        item.modifier = NUM2UINT(modifier);
+    }
+    else
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong argument type %s (expected String or Array)",
+            rb_obj_classname(accel)
+        );
+    }
+
+    g_array_append_val((GArray *) args[0], item);
+
+    return ST_CONTINUE;
+}
+
+/**
+ * Parses the Hash passed to {Gtk3::AccelMap.import} and applies the entries
+ * once all of them have been parsed.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Array containing the arguments.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_map_import_items(VALUE data)
+{
+    guint index;
+    GtkAccelKey existing;
+    RAccelMapItem *item;
+    VALUE *args   = (VALUE *) data;
+    GArray *items = (GArray *) args[0];
+
+    rb_hash_foreach(args[2], gtk3_accel_map_import_item, data);
+
+    for ( index = 0; index < items->len; index++ )
+    {
+        item = &g_array_index(items, RAccelMapItem, index);
+
+        if ( gtk_accel_map_lookup_entry(item->path, &existing) )
+        {
+            gtk_accel_map_change_entry(
+                item->path,
+                item->key,
+                item->modifier,
+                FALSE
+            );
+        }
+        else
+        {
+            gtk_accel_map_add_entry(item->path, item->key, item->modifier);
+
+            /* Imported entries are changes made by the user. */
+            gtk3_accel_map_entry_changed(
+                item->path,
+                item->key,
+                item->modifier,
+                TRUE
+            );
+        }
+    }
+
+    return Qnil;
+}
+
+/**
+ * Frees a GArray of RAccelMapItem structures.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] items The GArray to free.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_map_free_items(VALUE items)
+{
+    g_array_free((GArray *) items, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Adds or changes many accelerators at once. The keys of the Hash are
+ * accelerator paths, the values are either accelerators such as "<Control>s"
+ * or Arrays containing a key and modifier. Entries that don't exist yet are
+ * added, existing entries are changed.
+ *
+ * All entries are parsed before any of them is applied, if an entry is
+ * invalid an error is raised and the accelerator map is left untouched.
+ *
+ * @example
+ *  Gtk3::AccelMap.import(
+ *    '<App>/File/Save' => '<Control>s',
+ *    '<App>/File/Quit' => [113, Gtk3::ModifierType::CONTROL]
+ *  )
+ *
+ * @since  2026-10-19
+ * @param  [Hash] entries The accelerator paths and their accelerators.
+ * @return [Fixnum] The amount of imported entries.
+ */
+static VALUE gtk3_accel_map_import(VALUE self, VALUE entries)
+{
+    VALUE args[3];
+    GArray *items;
+
+    Check_Type(entries, T_HASH);
+
+    items = g_array_sized_new(
+        FALSE,
+        FALSE,
+        sizeof(RAccelMapItem),
+        RHASH_SIZE(entries)
+    );
+
+    args[0] = (VALUE) items;
+    args[1] = rb_ary_new2(RHASH_SIZE(entries));
+    args[2] = entries;
+
+    rb_ensure(
+        gtk3_accel_map_import_items,
+        (VALUE) args,
+        gtk3_accel_map_free_items,
+        (VALUE) items
+    );
+
+    return LONG2NUM(RHASH_SIZE(entries));
+}
+
+/**
+ * Called by gtk_accel_map_foreach_unfiltered() to collect all entries.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The GArray to add the entry to.
+ * @param [const gchar *] path The accelerator path of the entry.
+ * @param [guint] key The accelerator key of the entry.
+ * @param [GdkModifierType] modifier The modifier of the entry.
+ * @param [gboolean] changed Whether the entry was changed at runtime.
+ */
+static void gtk3_accel_map_collect(
+    gpointer data,
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+)
+{
+    RAccelMapItem item;
+
+    /* GTK stores accelerator paths as interned strings. */
+    item.path     = path;
+    item.key      = key;
+    item.modifier = modifier;
+    item.changed  = changed;
+
+    g_array_append_val((GArray *) data, item);
+}
+
+/**
+ * Converts the collected entries to a Hash.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Array containing the GArray of entries and whether
+ *  only changed entries should be included.
+ * @return [Hash]
+ */
+static VALUE gtk3_accel_map_build_hash(VALUE data)
+{
+    guint index;
+    RAccelMapItem *item;
+    VALUE hash;
+    VALUE *args   = (VALUE *) data;
+    GArray *items = (GArray *) args[0];
+
+#ifdef HAVE_RB_HASH_NEW_CAPA
+    hash = rb_hash_new_capa(items->len);
+#else
+    hash = rb_hash_new();
+#endif
+
+    for ( index = 0; index < items->len; index++ )
+    {
+        item = &g_array_index(items, RAccelMapItem, index);
+
+        if ( RTEST(args[1]) && !item->changed )
+        {
+            continue;
+        }
+
+        rb_hash_aset(
+            hash,
+            gtk3_accel_map_path_string(item->path),
+            rb_ary_new3(2, UINT2NUM(item->key), UINT2NUM(item->modifier))
+        );
+    }
+
+    return hash;
+}
+
+/**
+ * Returns all accelerator map entries as a Hash. The keys are the
+ * accelerator paths, the values Arrays containing the key and modifier. The
+ * returned Hash can be passed to {Gtk3::AccelMap.import}.
+ *
+ * @example
+ *  Gtk3::AccelMap.to_h
+ *  # => {"<App>/File/Quit" => [113, 4]}
+ *
+ *  Gtk3::AccelMap.to_h(:changed_only => true)
+ *
+ * @since  2026-10-19
+ * @param  [Hash] options Hash containing extra options. Setting
+ *  `:changed_only` to true only includes entries changed at runtime.
+ * @return [Hash]
+ */
+static VALUE gtk3_accel_map_to_h(int argc, VALUE *argv, VALUE self)
+{
+    VALUE options;
+    VALUE args[2];
+    GArray *items;
+
+    rb_scan_args(argc, argv, "01", &options);
+
+    args[1] = Qfalse;
+
+    if ( !NIL_P(options) )
+    {
+        Check_Type(options, T_HASH);
+
+        args[1] = rb_hash_aref(options, ID2SYM(gtk3_id_changed_only));
+    }
+
+    items = g_array_new(FALSE, FALSE, sizeof(RAccelMapItem));
+
+    gtk_accel_map_foreach_unfiltered(items, gtk3_accel_map_collect);
+
+    args[0] = (VALUE) items;
+
+    return rb_ensure(
+        gtk3_accel_map_build_hash,
+        (VALUE) args,
+        gtk3_accel_map_free_items,
+        (VALUE) items
+    );
+}
+
 /**
  * Initializes the module.
  *
@@ -344,6 +1109,38 @@ void Init_gtk3_accel_map()
 {
     gtk3_mAccelMap = rb_define_module_under(gtk3_mGtk3, "AccelMap");
 
+    gtk3_id_changed_only = rb_intern("changed_only");
+    gtk3_id_read         = rb_intern("read");
+    gtk3_id_write        = rb_intern("write");
+    gtk3_accel_map_paths = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk3_accel_map_paths_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_accel_map_paths_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_accel_map_paths_keeper);
+
+    gtk3_accel_map_saves = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk3_accel_map_saves_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_accel_map_saves_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_accel_map_saves_keeper);
+
+    g_signal_connect(
+        gtk_accel_map_get(),
+        "changed",
+        G_CALLBACK(gtk3_accel_map_changed),
+        NULL
+    );
+
     rb_define_singleton_method(
         gtk3_mAccelMap,
         "add_entry",
@@ -402,4 +1199,53 @@ void Init_gtk3_accel_map()
         gtk3_accel_map_unlock_path,
         1
     );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "import",
+        gtk3_accel_map_import,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "to_h",
+        gtk3_accel_map_to_h,
+        -1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "dump",
+        gtk3_accel_map_dump_string,
+        0
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "load_string",
+        gtk3_accel_map_load_string,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "load_io",
+        gtk3_accel_map_load_io,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "save_io",
+        gtk3_accel_map_save_io,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "save_async",
+        gtk3_accel_map_save_async,
+        1
+    );
 }
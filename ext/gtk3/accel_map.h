@@ -3,7 +3,20 @@
 
 #include "gtk3.h"
 
-extern VALUE gtk3_cAccelMap;
+extern VALUE gtk3_mAccelMap;
+
+extern VALUE gtk3_accel_map_path_string(const gchar *path);
+extern gchar *gtk3_accel_map_dump();
+
+extern void gtk3_accel_map_dump_entry(
+    gpointer data,
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+);
+
+extern void gtk3_accel_map_load_text(const gchar *text, gsize length);
 
 extern void Init_gtk3_accel_map();
 
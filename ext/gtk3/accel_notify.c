@@ -0,0 +1,320 @@
+#include "accel_notify.h"
+
+/**
+ * Array of the Procs to call when accelerator map entries have changed.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_accel_notify_handlers;
+
+/**
+ * The accelerator paths that changed since the handlers were last called, in
+ * the order they first changed. The strings are owned by the quark table.
+ *
+ * @since 2026-10-19
+ */
+static GPtrArray *gtk3_accel_notify_pending;
+
+/**
+ * Set of the quarks of the paths in gtk3_accel_notify_pending.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_notify_pending_set;
+
+/**
+ * The ID of the idle source that calls the handlers, 0 if none is scheduled.
+ *
+ * @since 2026-10-19
+ */
+static guint gtk3_accel_notify_idle_id = 0;
+
+/**
+ * The amount of {Gtk3::AccelMap.batch} blocks currently being executed.
+ *
+ * @since 2026-10-19
+ */
+static guint gtk3_accel_notify_depth = 0;
+
+/* Helper methods */
+
+/**
+ * Calls the handlers with the paths that changed since they were last called.
+ * The pending paths are cleared before any handler is called, so changes made
+ * by a handler are reported separately.
+ *
+ * When called from the main loop the handlers are called using
+ * gtk3_call_protected() as exceptions can't be raised through the main loop.
+ *
+ * @since 2026-10-19
+ * @param [gboolean] main_loop Whether this is called from the main loop.
+ */
+static void gtk3_accel_notify_flush(gboolean main_loop)
+{
+    guint index;
+    long position;
+    VALUE paths;
+    VALUE handlers;
+
+    if ( gtk3_accel_notify_idle_id )
+    {
+        g_source_remove(gtk3_accel_notify_idle_id);
+
+        gtk3_accel_notify_idle_id = 0;
+    }
+
+    if ( gtk3_accel_notify_pending->len == 0 )
+    {
+        return;
+    }
+
+    paths = rb_ary_new2(gtk3_accel_notify_pending->len);
+
+    for ( index = 0; index < gtk3_accel_notify_pending->len; index++ )
+    {
+        rb_ary_push(
+            paths,
+            gtk3_accel_map_path_string(
+                g_ptr_array_index(gtk3_accel_notify_pending, index)
+            )
+        );
+    }
+
+    g_ptr_array_set_size(gtk3_accel_notify_pending, 0);
+    g_hash_table_remove_all(gtk3_accel_notify_pending_set);
+
+    rb_obj_freeze(paths);
+
+    /* Handlers may be removed by other handlers. */
+    handlers = rb_ary_dup(gtk3_accel_notify_handlers);
+
+    for ( position = 0; position < RARRAY_LEN(handlers); position++ )
+    {
+        if ( main_loop )
+        {
+            gtk3_call_protected(rb_ary_entry(handlers, position), paths);
+        }
+        else
+        {
+            rb_funcall(
+                rb_ary_entry(handlers, position),
+                gtk3_id_call,
+                1,
+                paths
+            );
+        }
+    }
+}
+
+/**
+ * Called by the main loop to deliver the pending changes. Changes made inside
+ * a {Gtk3::AccelMap.batch} block are delivered once the block finishes.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data Unused.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_notify_idle(gpointer data)
+{
+    gtk3_accel_notify_idle_id = 0;
+
+    if ( gtk3_accel_notify_depth == 0 )
+    {
+        gtk3_accel_notify_flush(TRUE);
+    }
+
+    return FALSE;
+}
+
+/**
+ * Schedules the delivery of the pending changes, unless already scheduled.
+ *
+ * @since 2026-10-19
+ */
+static void gtk3_accel_notify_schedule()
+{
+    if ( !gtk3_accel_notify_idle_id && gtk3_accel_notify_pending->len > 0 )
+    {
+        gtk3_accel_notify_idle_id = g_idle_add(gtk3_accel_notify_idle, NULL);
+    }
+}
+
+/**
+ * Adds a changed accelerator path to the pending changes. Nothing is recorded
+ * if there are no handlers.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The accelerator path that changed.
+ */
+void gtk3_accel_notify_record(const gchar *path)
+{
+    gpointer quark;
+
+    if ( RARRAY_LEN(gtk3_accel_notify_handlers) == 0 )
+    {
+        return;
+    }
+
+    quark = GUINT_TO_POINTER(g_quark_from_string(path));
+
+    if ( g_hash_table_contains(gtk3_accel_notify_pending_set, quark) )
+    {
+        return;
+    }
+
+    g_hash_table_add(gtk3_accel_notify_pending_set, quark);
+
+    g_ptr_array_add(
+        gtk3_accel_notify_pending,
+        (gpointer) g_quark_to_string(GPOINTER_TO_UINT(quark))
+    );
+
+    if ( gtk3_accel_notify_depth == 0 )
+    {
+        gtk3_accel_notify_schedule();
+    }
+}
+
+/**
+ * Leaves a batch. If this was the outermost batch any pending changes are
+ * scheduled for delivery, this ensures they're delivered even when the block
+ * raised an error.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Unused.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_notify_leave(VALUE data)
+{
+    gtk3_accel_notify_depth--;
+
+    if ( gtk3_accel_notify_depth == 0 )
+    {
+        gtk3_accel_notify_schedule();
+    }
+
+    return Qnil;
+}
+
+/* Class methods */
+
+/**
+ * Registers a block to call whenever accelerator map entries change. Changes
+ * are coalesced: the block is called from the main loop with a frozen Array
+ * of all the paths that changed since it was last called, each path is
+ * included only once. Exceptions raised by the block are raised by
+ * {Gtk3.main} or {Gtk3.main\_iteration}, the other blocks are still called.
+ *
+ * @example
+ *  Gtk3::AccelMap.on_changed do |paths|
+ *    paths.each { |path| refresh_menu_label(path) }
+ *  end
+ *
+ * @since  2026-10-19
+ * @return [Proc] The block, which can be passed to
+ *  {Gtk3::AccelMap.remove_changed_handler}.
+ */
+static VALUE gtk3_accel_notify_on_changed(VALUE class)
+{
+    VALUE handler;
+
+    rb_need_block();
+
+    handler = rb_block_proc();
+
+    rb_ary_push(gtk3_accel_notify_handlers, handler);
+
+    return handler;
+}
+
+/**
+ * Removes a block registered using {Gtk3::AccelMap.on_changed}.
+ *
+ * @since  2026-10-19
+ * @param  [Proc] handler The block to remove.
+ * @return [TrueClass|FalseClass] `true` if the block was registered.
+ */
+static VALUE gtk3_accel_notify_remove(VALUE class, VALUE handler)
+{
+    VALUE removed = rb_ary_delete(gtk3_accel_notify_handlers, handler);
+
+    if ( RARRAY_LEN(gtk3_accel_notify_handlers) == 0 )
+    {
+        g_ptr_array_set_size(gtk3_accel_notify_pending, 0);
+        g_hash_table_remove_all(gtk3_accel_notify_pending_set);
+    }
+
+    return NIL_P(removed) ? Qfalse : Qtrue;
+}
+
+/**
+ * Executes the block and delivers all changes made inside it to the
+ * {Gtk3::AccelMap.on_changed} handlers at once, directly after the block
+ * finishes. Batches can be nested, changes are delivered when the outermost
+ * batch finishes.
+ *
+ * @example
+ *  Gtk3::AccelMap.batch do
+ *    Gtk3::AccelMap.load('keymap.rc')
+ *    Gtk3::AccelMap.change_entry('<App>/Quit', 113, :control, true)
+ *  end
+ *
+ * @since  2026-10-19
+ * @return [Mixed] The return value of the block.
+ */
+static VALUE gtk3_accel_notify_batch(VALUE class)
+{
+    VALUE result;
+
+    rb_need_block();
+
+    gtk3_accel_notify_depth++;
+
+    result = rb_ensure(rb_yield, Qnil, gtk3_accel_notify_leave, Qnil);
+
+    if ( gtk3_accel_notify_depth == 0 )
+    {
+        gtk3_accel_notify_flush(FALSE);
+    }
+
+    return result;
+}
+
+/**
+ * Sets up the change notification methods of {Gtk3::AccelMap}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_notify()
+{
+    gtk3_accel_notify_handlers = rb_ary_new();
+
+    rb_global_variable(&gtk3_accel_notify_handlers);
+
+    gtk3_accel_notify_pending     = g_ptr_array_new();
+    gtk3_accel_notify_pending_set = g_hash_table_new(
+        g_direct_hash,
+        g_direct_equal
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "on_changed",
+        gtk3_accel_notify_on_changed,
+        0
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "remove_changed_handler",
+        gtk3_accel_notify_remove,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "batch",
+        gtk3_accel_notify_batch,
+        0
+    );
+}
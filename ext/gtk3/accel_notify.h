@@ -0,0 +1,10 @@
+#ifndef GTK3_ACCEL_NOTIFY
+#define GTK3_ACCEL_NOTIFY
+
+#include "gtk3.h"
+
+extern void gtk3_accel_notify_record(const gchar *path);
+
+extern void Init_gtk3_accel_notify();
+
+#endif
@@ -0,0 +1,436 @@
+#include "accel_search.h"
+
+/**
+ * The score added for every character of the query found in a path.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_ACCEL_SEARCH_MATCH 1
+
+/**
+ * The score added when a character directly follows the previously matched
+ * character.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_ACCEL_SEARCH_CONSECUTIVE 5
+
+/**
+ * The score added when a character is found at the start of a path segment or
+ * word.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_ACCEL_SEARCH_BOUNDARY 3
+
+/**
+ * Array of RAccelSearchEntry structures sorted on their folded paths. Prefix
+ * matches are always stored next to each other and can be found using a
+ * binary search.
+ *
+ * @since 2026-10-19
+ */
+static GPtrArray *gtk3_accel_search_entries;
+
+/**
+ * Hash table that maps the quarks of accelerator paths to their entries.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_accel_search_paths;
+
+/* Helper methods */
+
+/**
+ * Returns the index of the first entry of which the folded path isn't sorted
+ * before the given string.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] folded The case folded string to look for.
+ * @return [guint]
+ */
+static guint gtk3_accel_search_lower_bound(const gchar *folded)
+{
+    RAccelSearchEntry *entry;
+    guint low  = 0;
+    guint high = gtk3_accel_search_entries->len;
+    guint middle;
+
+    while ( low < high )
+    {
+        middle = low + (high - low) / 2;
+        entry  = g_ptr_array_index(gtk3_accel_search_entries, middle);
+
+        if ( strcmp(entry->folded, folded) < 0 )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    return low;
+}
+
+/**
+ * Returns `TRUE` if a matched character starts a path segment or word.
+ *
+ * @since  2026-10-19
+ * @param  [gunichar] previous The character before the matched character.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_search_boundary(gunichar previous)
+{
+    return previous == '/' || previous == '<' || previous == '>'
+        || previous == '_' || previous == '-' || g_unichar_isspace(previous);
+}
+
+/**
+ * Scores a path by checking if the characters of the query occur in the path
+ * in the same order. Consecutive characters and characters at the start of a
+ * segment score higher, paths where the first match occurs earlier are
+ * preferred over others. If not all characters were found -1 is returned.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] folded The case folded path.
+ * @param  [const gchar *] query The case folded query.
+ * @return [gint]
+ */
+static gint gtk3_accel_search_score(const gchar *folded, const gchar *query)
+{
+    gint score        = 0;
+    gint position     = 0;
+    gint first        = -1;
+    gint last         = -2;
+    gunichar previous = '/';
+    gunichar current;
+    gunichar wanted;
+
+    if ( !*query )
+    {
+        return 0;
+    }
+
+    wanted = g_utf8_get_char(query);
+
+    while ( *folded )
+    {
+        current = g_utf8_get_char(folded);
+
+        if ( current == wanted )
+        {
+            score += GTK3_ACCEL_SEARCH_MATCH;
+
+            if ( position == last + 1 )
+            {
+                score += GTK3_ACCEL_SEARCH_CONSECUTIVE;
+            }
+
+            if ( gtk3_accel_search_boundary(previous) )
+            {
+                score += GTK3_ACCEL_SEARCH_BOUNDARY;
+            }
+
+            if ( first < 0 )
+            {
+                first = position;
+            }
+
+            last  = position;
+            query = g_utf8_next_char(query);
+
+            if ( !*query )
+            {
+                return score * 16 - MIN(first, 15);
+            }
+
+            wanted = g_utf8_get_char(query);
+        }
+
+        previous = current;
+        folded   = g_utf8_next_char(folded);
+
+        position++;
+    }
+
+    return -1;
+}
+
+/**
+ * Adds a scored entry to the top matches, starting at the given offset. The
+ * matches after the offset are sorted on their scores in descending order,
+ * entries with the same score keep the order of the index.
+ *
+ * @since 2026-10-19
+ * @param [GArray *] matches The matches to add the entry to.
+ * @param [guint] offset The index of the first scored match.
+ * @param [guint] limit The maximum amount of matches.
+ * @param [RAccelSearchMatch *] match The match to add.
+ */
+static void gtk3_accel_search_add_match(
+    GArray *matches,
+    guint offset,
+    guint limit,
+    RAccelSearchMatch *match
+)
+{
+    guint index = matches->len;
+
+    if ( matches->len == limit )
+    {
+        if ( g_array_index(matches, RAccelSearchMatch, limit - 1).score
+        >= match->score )
+        {
+            return;
+        }
+
+        g_array_set_size(matches, limit - 1);
+
+        index = matches->len;
+    }
+
+    while ( index > offset
+    && g_array_index(matches, RAccelSearchMatch, index - 1).score
+        < match->score )
+    {
+        index--;
+    }
+
+    g_array_insert_val(matches, index, *match);
+}
+
+/**
+ * Builds the Array returned by {Gtk3::AccelMap.search}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GArray containing the matches.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_search_build_array(VALUE data)
+{
+    guint index;
+    RAccelSearchEntry *entry;
+    GArray *matches = (GArray *) data;
+    VALUE results   = rb_ary_new2(matches->len);
+
+    for ( index = 0; index < matches->len; index++ )
+    {
+        entry = g_array_index(matches, RAccelSearchMatch, index).entry;
+
+        rb_ary_push(
+            results,
+            rb_ary_new3(
+                2,
+                gtk3_accel_map_path_string(entry->path),
+                gtk3_accel_cache_label(entry->key, entry->modifier)
+            )
+        );
+    }
+
+    return results;
+}
+
+/**
+ * Frees the GArray of matches.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GArray to free.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_search_free_matches(VALUE data)
+{
+    g_array_free((GArray *) data, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Adds an accelerator path to the index or updates the accelerator of an
+ * existing path. Accelerator paths can't be removed from the accelerator map,
+ * thus entries are never removed from the index.
+ *
+ * @since 2026-10-19
+ * @param [const gchar *] path The accelerator path.
+ * @param [guint] key The accelerator key of the path.
+ * @param [GdkModifierType] modifier The accelerator modifier of the path.
+ */
+void gtk3_accel_search_update(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    GQuark quark             = g_quark_from_string(path);
+    RAccelSearchEntry *entry = g_hash_table_lookup(
+        gtk3_accel_search_paths,
+        GUINT_TO_POINTER(quark)
+    );
+
+    if ( !entry )
+    {
+        entry = g_new(RAccelSearchEntry, 1);
+
+        entry->path   = g_quark_to_string(quark);
+        entry->folded = g_utf8_casefold(path, -1);
+
+        g_ptr_array_insert(
+            gtk3_accel_search_entries,
+            gtk3_accel_search_lower_bound(entry->folded),
+            entry
+        );
+
+        g_hash_table_insert(
+            gtk3_accel_search_paths,
+            GUINT_TO_POINTER(quark),
+            entry
+        );
+    }
+
+    entry->key      = key;
+    entry->modifier = modifier;
+}
+
+/**
+ * Called by gtk_accel_map_foreach_unfiltered() to add the existing entries of
+ * the accelerator map to the index.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data Unused.
+ * @param [const gchar *] path The accelerator path of the entry.
+ * @param [guint] key The accelerator key of the entry.
+ * @param [GdkModifierType] modifier The accelerator modifier of the entry.
+ * @param [gboolean] changed Unused.
+ */
+static void gtk3_accel_search_add_existing(
+    gpointer data,
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier,
+    gboolean changed
+)
+{
+    gtk3_accel_search_update(path, key, modifier);
+}
+
+/* Class methods */
+
+/**
+ * Searches the accelerator paths using the given query and returns the best
+ * matches along with the labels of their accelerators. Paths starting with
+ * the query (ignoring case) are returned first in alphabetical order,
+ * followed by paths that contain the characters of the query in the same
+ * order, best matches first.
+ *
+ * @example
+ *  Gtk3::AccelMap.search('filesa', 2)
+ *  # => [["<App>/File/Save", "Ctrl+S"], ["<App>/File/Save As", "Shift+Ctrl+S"]]
+ *
+ * @since  2026-10-19
+ * @param  [String] query The text to search for.
+ * @param  [Fixnum] limit The maximum amount of results, defaults to 10.
+ * @return [Array]
+ */
+static VALUE gtk3_accel_search_search(int argc, VALUE *argv, VALUE class)
+{
+    VALUE query;
+    VALUE rb_limit;
+    guint limit;
+    guint index;
+    guint start;
+    guint prefixes;
+    gchar *folded;
+    GArray *matches;
+    RAccelSearchMatch match;
+    RAccelSearchEntry *entry;
+
+    rb_scan_args(argc, argv, "11", &query, &rb_limit);
+
+    if ( !NIL_P(rb_limit) && NUM2INT(rb_limit) < 0 )
+    {
+        rb_raise(rb_eArgError, "negative limit");
+    }
+
+    limit  = NIL_P(rb_limit) ? 10 : NUM2UINT(rb_limit);
+    folded = g_utf8_casefold(gtk3_string_value_utf8(&query), -1);
+
+    /* The limit is caller supplied, only preallocate what can be matched. */
+    matches = g_array_sized_new(
+        FALSE,
+        FALSE,
+        sizeof(RAccelSearchMatch),
+        MIN(limit, gtk3_accel_search_entries->len)
+    );
+
+    start = gtk3_accel_search_lower_bound(folded);
+
+    for ( index = start; index < gtk3_accel_search_entries->len; index++ )
+    {
+        entry = g_ptr_array_index(gtk3_accel_search_entries, index);
+
+        if ( matches->len == limit || !g_str_has_prefix(entry->folded, folded) )
+        {
+            break;
+        }
+
+        match.entry = entry;
+        match.score = G_MAXINT;
+
+        g_array_append_val(matches, match);
+    }
+
+    prefixes = matches->len;
+
+    /* All prefix matches have been collected if the limit wasn't reached. */
+    for ( index = 0; index < gtk3_accel_search_entries->len; index++ )
+    {
+        if ( prefixes == limit )
+        {
+            break;
+        }
+
+        if ( index >= start && index < start + prefixes )
+        {
+            continue;
+        }
+
+        entry       = g_ptr_array_index(gtk3_accel_search_entries, index);
+        match.entry = entry;
+        match.score = gtk3_accel_search_score(entry->folded, folded);
+
+        if ( match.score >= 0 )
+        {
+            gtk3_accel_search_add_match(matches, prefixes, limit, &match);
+        }
+    }
+
+    g_free(folded);
+
+    return rb_ensure(
+        gtk3_accel_search_build_array,
+        (VALUE) matches,
+        gtk3_accel_search_free_matches,
+        (VALUE) matches
+    );
+}
+
+/**
+ * Sets up the search index and adds the search method to {Gtk3::AccelMap}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_search()
+{
+    gtk3_accel_search_entries = g_ptr_array_new();
+    gtk3_accel_search_paths   = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk_accel_map_foreach_unfiltered(NULL, gtk3_accel_search_add_existing);
+
+    rb_define_singleton_method(
+        gtk3_mAccelMap,
+        "search",
+        gtk3_accel_search_search,
+        -1
+    );
+}
@@ -0,0 +1,43 @@
+#ifndef GTK3_ACCEL_SEARCH
+#define GTK3_ACCEL_SEARCH
+
+#include "gtk3.h"
+
+/**
+ * Structure containing a single accelerator path in the search index.
+ *
+ * * path: the accelerator path, owned by the quark table of GLib.
+ * * folded: the case folded version of the path, used for matching.
+ * * key: the accelerator key of the path.
+ * * modifier: the accelerator modifier of the path.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelSearchEntry
+{
+    const gchar *path;
+    gchar *folded;
+    guint key;
+    GdkModifierType modifier;
+} RAccelSearchEntry;
+
+/**
+ * Structure containing a search result and its score.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelSearchMatch
+{
+    RAccelSearchEntry *entry;
+    gint score;
+} RAccelSearchMatch;
+
+extern void gtk3_accel_search_update(
+    const gchar *path,
+    guint key,
+    GdkModifierType modifier
+);
+
+extern void Init_gtk3_accel_search();
+
+#endif
@@ -0,0 +1,470 @@
+#include "accel_table.h"
+
+/**
+ * Quark used for storing the RAccelTable of an accelerator group.
+ *
+ * @since 2026-10-19
+ */
+static GQuark gtk3_accel_table_quark;
+
+/**
+ * Structure used for a parsed entry of the Hash passed to
+ * {Gtk3::AccelGroup#bind_table}.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelTableItem
+{
+    guint key;
+    GdkModifierType modifier;
+    VALUE callable;
+} RAccelTableItem;
+
+/**
+ * Hashes the key and modifier of a binding.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] data The binding to hash.
+ * @return [guint]
+ */
+static guint gtk3_accel_binding_hash(gconstpointer data)
+{
+    const RAccelBinding *binding = data;
+
+    return binding->key ^ ((guint) binding->modifier << 16);
+}
+
+/**
+ * Returns TRUE if two bindings use the same key and modifier.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] a The first binding.
+ * @param  [gconstpointer] b The second binding.
+ * @return [gboolean]
+ */
+static gboolean gtk3_accel_binding_equal(gconstpointer a, gconstpointer b)
+{
+    const RAccelBinding *binding_a = a;
+    const RAccelBinding *binding_b = b;
+
+    return binding_a->key == binding_b->key
+        && binding_a->modifier == binding_b->modifier;
+}
+
+/**
+ * Marshal function shared by all the bindings. The binding itself contains
+ * the callable to call so no lookups are needed. Bindings that raise don't
+ * handle the key press, the exception is raised once control returns to Ruby.
+ *
+ * @since 2026-10-19
+ * @param [GClosure] closure The closure of the binding.
+ * @param [GValue] return_value The return value of the callback.
+ * @param [guint] n_param_values The amount of parameters.
+ * @param [GValue] param_values Array of arguments for the callback.
+ * @param [gpointer] invocation_hint The invocation hint of the callback.
+ * @param [gpointer] marshal_data Extra data of the marshal function.
+ */
+static void gtk3_accel_table_marshal(
+    GClosure *closure,
+    GValue *return_value,
+    guint n_param_values,
+    const GValue *param_values,
+    gpointer invocation_hint,
+    gpointer marshal_data
+)
+{
+    VALUE rb_return_value;
+    RAccelBinding *binding = (RAccelBinding *) closure;
+    RAccelTable *table     = (RAccelTable *) closure->data;
+
+    if ( NIL_P(binding->callable) )
+    {
+        return;
+    }
+
+    rb_return_value = gtk3_call_protected(
+        binding->callable,
+        gtk3_object_wrap(Qnil, table->group, FALSE)
+    );
+
+    if ( return_value != NULL && G_VALUE_HOLDS_BOOLEAN(return_value) )
+    {
+        g_value_set_boolean(return_value, RTEST(rb_return_value));
+    }
+}
+
+/**
+ * Releases a binding that is removed from its table. Closures can outlive the
+ * table (e.g. when referenced by a {Gtk3::AccelGroupEntry}), so the callable
+ * is unset as it's no longer kept alive.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The binding to release.
+ */
+static void gtk3_accel_binding_release(gpointer data)
+{
+    RAccelBinding *binding = (RAccelBinding *) data;
+
+    binding->callable = Qnil;
+
+    g_closure_unref(&binding->closure);
+}
+
+/**
+ * Returns the callable of a closure created by {Gtk3::AccelGroup#bind_table},
+ * or nil for any other closure.
+ *
+ * @since  2026-10-19
+ * @param  [GClosure *] closure The closure.
+ * @return [VALUE]
+ */
+VALUE gtk3_accel_table_callable(GClosure *closure)
+{
+    if ( closure == NULL || closure->marshal != gtk3_accel_table_marshal )
+    {
+        return Qnil;
+    }
+
+    return ((RAccelBinding *) closure)->callable;
+}
+
+/**
+ * Frees the table of an accelerator group once the group is finalized.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The RAccelTable to free.
+ */
+static void gtk3_accel_table_free(gpointer data)
+{
+    RAccelTable *table = (RAccelTable *) data;
+
+    g_hash_table_destroy(table->bindings);
+
+    rb_gc_unregister_address(&table->callables);
+
+    g_free(table);
+}
+
+/**
+ * Returns the table of an accelerator group, creating it if needed.
+ *
+ * @since  2026-10-19
+ * @param  [GtkAccelGroup *] group The accelerator group.
+ * @return [RAccelTable *]
+ */
+static RAccelTable *gtk3_accel_table_get(GtkAccelGroup *group)
+{
+    RAccelTable *table;
+
+    table = g_object_get_qdata(G_OBJECT(group), gtk3_accel_table_quark);
+
+    if ( table != NULL )
+    {
+        return table;
+    }
+
+    table             = g_new(RAccelTable, 1);
+    table->group      = group;
+    table->callables  = rb_ary_new();
+    table->generation = 0;
+    table->bindings   = g_hash_table_new_full(
+        gtk3_accel_binding_hash,
+        gtk3_accel_binding_equal,
+        NULL,
+        gtk3_accel_binding_release
+    );
+
+    rb_gc_register_address(&table->callables);
+
+    g_object_set_qdata_full(
+        G_OBJECT(group),
+        gtk3_accel_table_quark,
+        table,
+        gtk3_accel_table_free
+    );
+
+    return table;
+}
+
+/**
+ * Parses an accelerator of the Hash passed to {Gtk3::AccelGroup#bind_table}.
+ * Accelerators can be Strings such as "<Control>q" or Arrays containing a key
+ * and modifier.
+ *
+ * @since 2026-10-19
+ * @param [VALUE] accel The accelerator to parse.
+ * @param [RAccelTableItem *] item The item to store the key and modifier in.
+ */
+static void gtk3_accel_table_parse(VALUE accel, RAccelTableItem *item)
+{
+    guint key;
+    GdkModifierType modifier;
+
+    if ( TYPE(accel) == T_STRING )
+    {
+        gtk_accelerator_parse(gtk3_string_value_utf8(&accel), &key, &modifier);
+
+        if ( key == 0 )
+        {
+            rb_raise(
+                rb_eArgError,
+                "invalid accelerator %s",
+                RSTRING_PTR(accel)
+            );
+        }
+    }
+    else if ( TYPE(accel) == T_ARRAY && RARRAY_LEN(accel) == 2 )
+    {
+        key = NUM2INT(gtk3_lookup_accelerator_key(rb_ary_entry(accel, 0)));
+
+        modifier = NUM2INT(
+            gtk3_lookup_accelerator_modifier(rb_ary_entry(accel, 1))
+        );
+    }
+    else
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong argument type %s (expected String or Array)",
+            rb_obj_classname(accel)
+        );
+    }
+
+    if ( !gtk_accelerator_valid(key, modifier) )
+    {
+        rb_raise(rb_eArgError, "invalid key value and/or modifier");
+    }
+
+    /* GTK stores the keys of accelerators in lowercase. */
+    item->key      = gdk_keyval_to_lower(key);
+    item->modifier = modifier;
+}
+
+/**
+ * Called for every pair of the Hash passed to {Gtk3::AccelGroup#bind_table}.
+ * The parsed item is added to the GArray, the callable is added to the new
+ * Array of callables.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] accel The accelerator.
+ * @param  [VALUE] callable The object to call for the accelerator.
+ * @param  [VALUE] data Array containing the GArray and callables.
+ * @return [int]
+ */
+static int gtk3_accel_table_add_item(VALUE accel, VALUE callable, VALUE data)
+{
+    RAccelTableItem item;
+    VALUE *args = (VALUE *) data;
+
+    if ( !rb_respond_to(callable, gtk3_id_call) )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong argument type %s (expected an object responding to call)",
+            rb_obj_classname(callable)
+        );
+    }
+
+    gtk3_accel_table_parse(accel, &item);
+
+    item.callable = callable;
+
+    g_array_append_val((GArray *) args[0], item);
+
+    rb_ary_push(args[1], callable);
+
+    return ST_CONTINUE;
+}
+
+/**
+ * Frees the GArray of parsed items.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] items The GArray to free.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_table_free_items(VALUE items)
+{
+    g_array_free((GArray *) items, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Connects a new binding to the accelerator group of a table.
+ *
+ * @since 2026-10-19
+ * @param [RAccelTable *] table The table to add the binding to.
+ * @param [RAccelTableItem *] item The key, modifier and callable to use.
+ */
+static void gtk3_accel_table_connect(RAccelTable *table, RAccelTableItem *item)
+{
+    GClosure *closure;
+    RAccelBinding *binding;
+
+    closure = g_closure_new_simple(sizeof(RAccelBinding), table);
+
+    g_closure_set_marshal(closure, gtk3_accel_table_marshal);
+
+    g_closure_ref(closure);
+    g_closure_sink(closure);
+
+    binding             = (RAccelBinding *) closure;
+    binding->key        = item->key;
+    binding->modifier   = item->modifier;
+    binding->callable   = item->callable;
+    binding->generation = table->generation;
+
+    g_hash_table_replace(table->bindings, binding, binding);
+
+    gtk_accel_group_connect(
+        table->group,
+        item->key,
+        item->modifier,
+        GTK_ACCEL_VISIBLE,
+        closure
+    );
+}
+
+/**
+ * Replaces the bindings of a table with the parsed items. Bindings that are
+ * still used keep their closure and only get a new callable, bindings that
+ * are no longer used are disconnected. This function doesn't call into Ruby.
+ *
+ * @since 2026-10-19
+ * @param [RAccelTable *] table The table to update.
+ * @param [GArray *] items The parsed items.
+ */
+static void gtk3_accel_table_swap(RAccelTable *table, GArray *items)
+{
+    guint index;
+    GHashTableIter iter;
+    gpointer data;
+    RAccelBinding query;
+    RAccelBinding *binding;
+    RAccelTableItem *item;
+
+    table->generation++;
+
+    for ( index = 0; index < items->len; index++ )
+    {
+        item           = &g_array_index(items, RAccelTableItem, index);
+        query.key      = item->key;
+        query.modifier = item->modifier;
+
+        binding = g_hash_table_lookup(table->bindings, &query);
+
+        /* Bindings removed using disconnect_key() are connected again. */
+        if ( binding != NULL && !binding->closure.is_invalid )
+        {
+            binding->callable   = item->callable;
+            binding->generation = table->generation;
+        }
+        else
+        {
+            gtk3_accel_table_connect(table, item);
+        }
+    }
+
+    g_hash_table_iter_init(&iter, table->bindings);
+
+    while ( g_hash_table_iter_next(&iter, &data, NULL) )
+    {
+        binding = (RAccelBinding *) data;
+
+        if ( binding->generation != table->generation )
+        {
+            gtk_accel_group_disconnect(table->group, &binding->closure);
+
+            g_hash_table_iter_remove(&iter);
+        }
+    }
+}
+
+/**
+ * Parses the Hash passed to {Gtk3::AccelGroup#bind_table} and swaps the
+ * bindings of the table once all of the Hash has been parsed.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Array containing the arguments.
+ * @return [VALUE]
+ */
+static VALUE gtk3_accel_table_bind(VALUE data)
+{
+    VALUE *args        = (VALUE *) data;
+    RAccelTable *table = (RAccelTable *) args[3];
+
+    rb_hash_foreach(args[2], gtk3_accel_table_add_item, data);
+
+    gtk3_accel_table_swap(table, (GArray *) args[0]);
+
+    table->callables = args[1];
+
+    return Qnil;
+}
+
+/**
+ * Replaces all the bindings installed by a previous call to this method with
+ * the bindings in the given Hash. The keys of the Hash are accelerators such
+ * as "<Control>s" or `[:s, :control]`, the values are objects that respond to
+ * `call`, they're called with the accelerator group as their only argument.
+ *
+ * Bindings are stored in a native table and dispatched without creating a
+ * Proc for every binding, making this method suitable for large sets of
+ * bindings that are swapped often (e.g. per editing mode). If any of the
+ * accelerators or callables is invalid an error is raised and the existing
+ * bindings are left untouched. Pass an empty Hash to remove all bindings.
+ *
+ * @example
+ *  group.bind_table(
+ *    '<Control>s' => method(:save),
+ *    [:q, :control] => proc { Gtk3.main_quit }
+ *  )
+ *
+ * @since  2026-10-19
+ * @param  [Hash] bindings The accelerators and their callables.
+ * @return [Gtk3::AccelGroup]
+ */
+static VALUE gtk3_accel_group_bind_table(VALUE self, VALUE bindings)
+{
+    VALUE args[4];
+    GtkAccelGroup *group;
+    GArray *items;
+
+    Check_Type(bindings, T_HASH);
+
+    Data_Get_Struct(self, GtkAccelGroup, group);
+
+    items = g_array_new(FALSE, FALSE, sizeof(RAccelTableItem));
+
+    args[0] = (VALUE) items;
+    args[1] = rb_ary_new();
+    args[2] = bindings;
+    args[3] = (VALUE) gtk3_accel_table_get(group);
+
+    rb_ensure(
+        gtk3_accel_table_bind,
+        (VALUE) args,
+        gtk3_accel_table_free_items,
+        (VALUE) items
+    );
+
+    return self;
+}
+
+/**
+ * Sets up the bind_table method of {Gtk3::AccelGroup}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_accel_table()
+{
+    gtk3_accel_table_quark = g_quark_from_static_string("gtk3-accel-table");
+
+    rb_define_method(
+        gtk3_cAccelGroup,
+        "bind_table",
+        gtk3_accel_group_bind_table,
+        1
+    );
+}
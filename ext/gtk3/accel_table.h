@@ -0,0 +1,47 @@
+#ifndef GTK3_ACCEL_TABLE
+#define GTK3_ACCEL_TABLE
+
+#include "gtk3.h"
+
+/**
+ * Structure used for a single binding installed using
+ * {Gtk3::AccelGroup#bind_table}. The structure is the closure connected to
+ * the accelerator group, all bindings share the same marshal function.
+ *
+ * * closure
+ * * key: the accelerator key.
+ * * modifier: the accelerator modifier.
+ * * callable: the object to call when the accelerator is activated.
+ * * generation: the generation of the table the binding was last used in.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelBinding
+{
+    GClosure closure;
+    guint key;
+    GdkModifierType modifier;
+    VALUE callable;
+    guint generation;
+} RAccelBinding;
+
+/**
+ * Structure containing the bindings of an accelerator group. It's stored as
+ * qdata on the group. The callables Array keeps the callables of all the
+ * bindings alive.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RAccelTable
+{
+    GtkAccelGroup *group;
+    GHashTable *bindings;
+    VALUE callables;
+    guint generation;
+} RAccelTable;
+
+extern VALUE gtk3_accel_table_callable(GClosure *closure);
+
+extern void Init_gtk3_accel_table();
+
+#endif
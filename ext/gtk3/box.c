@@ -0,0 +1,192 @@
+#include "box.h"
+
+/**
+ * ID for the `:horizontal` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_horizontal;
+
+/**
+ * ID for the `:vertical` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_vertical;
+
+/**
+ * Document-class: Gtk3::Box
+ *
+ * {Gtk3::Box} arranges its children in a single row or column.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cBox;
+
+/**
+ * Converts a Symbol to a GtkOrientation.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] orientation Either `:horizontal` or `:vertical`.
+ * @raise  [ArgumentError] Raised when an invalid orientation was specified.
+ * @return [GtkOrientation]
+ */
+GtkOrientation gtk3_orientation_from_rbvalue(VALUE orientation)
+{
+    if ( orientation == ID2SYM(gtk3_id_horizontal) )
+    {
+        return GTK_ORIENTATION_HORIZONTAL;
+    }
+
+    if ( orientation == ID2SYM(gtk3_id_vertical) )
+    {
+        return GTK_ORIENTATION_VERTICAL;
+    }
+
+    rb_raise(
+        rb_eArgError,
+        "invalid orientation %s (expected :horizontal or :vertical)",
+        RSTRING_PTR(rb_inspect(orientation))
+    );
+}
+
+/**
+ * Creates a new box.
+ *
+ * @example
+ *  box = Gtk3::Box.new(:vertical, 6)
+ *
+ * @since 2026-10-19
+ * @param [Symbol] orientation Either `:horizontal` (the default) or
+ *  `:vertical`.
+ * @param [Fixnum] spacing The amount of pixels between children, 0 by
+ *  default.
+ */
+static VALUE gtk3_box_new(int argc, VALUE *argv, VALUE class)
+{
+    VALUE orientation;
+    VALUE spacing;
+    VALUE rb_box;
+    GtkOrientation gtk_orientation = GTK_ORIENTATION_HORIZONTAL;
+    gint gtk_spacing               = 0;
+
+    rb_scan_args(argc, argv, "02", &orientation, &spacing);
+
+    if ( !NIL_P(orientation) )
+    {
+        gtk_orientation = gtk3_orientation_from_rbvalue(orientation);
+    }
+
+    if ( !NIL_P(spacing) )
+    {
+        gtk_spacing = NUM2INT(spacing);
+    }
+
+    gtk3_ensure_init();
+
+    rb_box = gtk3_object_wrap(
+        class,
+        gtk_box_new(gtk_orientation, gtk_spacing),
+        TRUE
+    );
+
+    rb_obj_call_init(rb_box, 0, NULL);
+
+    return rb_box;
+}
+
+/**
+ * Adds a child to the start of the box.
+ *
+ * @example
+ *  box.pack_start(label, true, true, 6)
+ *
+ * @since  2026-10-19
+ * @param  [Gtk3::Widget] child The widget to add.
+ * @param  [TrueClass|FalseClass] expand Whether the child gets extra space,
+ *  `false` by default.
+ * @param  [TrueClass|FalseClass] fill Whether the child fills its extra space,
+ *  `true` by default.
+ * @param  [Fixnum] padding The padding around the child, 0 by default.
+ * @raise  [ArgumentError] Raised when the widget already has a parent or is a
+ *  toplevel window.
+ * @return [Gtk3::Box]
+ */
+static VALUE gtk3_box_pack_start(int argc, VALUE *argv, VALUE self)
+{
+    VALUE child;
+    VALUE expand;
+    VALUE fill;
+    VALUE padding;
+    GtkWidget *box;
+    GtkWidget *widget;
+
+    rb_scan_args(argc, argv, "13", &child, &expand, &fill, &padding);
+
+    Data_Get_Struct(self, GtkWidget, box);
+
+    widget = gtk3_container_check_child(box, child, -1, NULL);
+
+    gtk_box_pack_start(
+        GTK_BOX(box),
+        widget,
+        RTEST(expand),
+        NIL_P(fill) ? TRUE : RTEST(fill),
+        NIL_P(padding) ? 0 : NUM2UINT(padding)
+    );
+
+    return self;
+}
+
+/**
+ * Returns the amount of pixels between the children.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_box_get_spacing(VALUE self)
+{
+    GtkWidget *box;
+
+    Data_Get_Struct(self, GtkWidget, box);
+
+    return INT2NUM(gtk_box_get_spacing(GTK_BOX(box)));
+}
+
+/**
+ * Sets the amount of pixels between the children.
+ *
+ * @since 2026-10-19
+ * @param [Fixnum] spacing The new spacing.
+ */
+static VALUE gtk3_box_set_spacing(VALUE self, VALUE spacing)
+{
+    GtkWidget *box;
+
+    Data_Get_Struct(self, GtkWidget, box);
+
+    gtk_box_set_spacing(GTK_BOX(box), NUM2INT(spacing));
+
+    return Qnil;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_box()
+{
+    gtk3_id_horizontal = rb_intern("horizontal");
+    gtk3_id_vertical   = rb_intern("vertical");
+
+    gtk3_cBox = rb_define_class_under(gtk3_mGtk3, "Box", gtk3_cContainer);
+
+    gtk3_object_register_class(GTK_TYPE_BOX, gtk3_cBox);
+
+    rb_define_singleton_method(gtk3_cBox, "new", gtk3_box_new, -1);
+
+    rb_define_method(gtk3_cBox, "pack_start", gtk3_box_pack_start, -1);
+    rb_define_method(gtk3_cBox, "spacing", gtk3_box_get_spacing, 0);
+    rb_define_method(gtk3_cBox, "spacing=", gtk3_box_set_spacing, 1);
+}
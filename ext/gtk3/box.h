@@ -0,0 +1,12 @@
+#ifndef GTK3_BOX
+#define GTK3_BOX
+
+#include "gtk3.h"
+
+extern VALUE gtk3_cBox;
+
+extern GtkOrientation gtk3_orientation_from_rbvalue(VALUE orientation);
+
+extern void Init_gtk3_box();
+
+#endif
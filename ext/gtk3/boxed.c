@@ -0,0 +1,142 @@
+#include "boxed.h"
+
+/**
+ * Document-class: Gtk3::Boxed
+ *
+ * {Gtk3::Boxed} is used for representing boxed structures that don't have a
+ * dedicated Ruby class, such as the value of a property or signal argument.
+ * Instances of this class can't be created manually, they can only be passed
+ * back to GTK.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cBoxed;
+
+/**
+ * Frees the boxed value and the RBoxed structure.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The RBoxed structure to free.
+ */
+static void gtk3_boxed_free(void *data)
+{
+    RBoxed *rboxed = (RBoxed *) data;
+
+    if ( rboxed->boxed != NULL )
+    {
+        g_boxed_free(rboxed->type, rboxed->boxed);
+    }
+
+    g_free(rboxed);
+}
+
+/**
+ * Returns the memory size of an RBoxed structure.
+ *
+ * @since  2026-10-19
+ * @param  [const void *] data The RBoxed structure.
+ * @return [size_t]
+ */
+static size_t gtk3_boxed_size(const void *data)
+{
+    return sizeof(RBoxed);
+}
+
+/**
+ * Data type of {Gtk3::Boxed} instances.
+ *
+ * @since 2026-10-19
+ */
+static const rb_data_type_t gtk3_boxed_type = {
+    "Gtk3::Boxed",
+    {NULL, gtk3_boxed_free, gtk3_boxed_size,},
+};
+
+/**
+ * Wraps a copy of a boxed value in an instance of {Gtk3::Boxed}.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type of the boxed value.
+ * @param  [gconstpointer] boxed The boxed value to copy.
+ * @return [VALUE]
+ */
+VALUE gtk3_boxed_wrap(GType type, gconstpointer boxed)
+{
+    VALUE rbboxed;
+    RBoxed *rboxed;
+
+    if ( boxed == NULL )
+    {
+        return Qnil;
+    }
+
+    rbboxed = TypedData_Make_Struct(
+        gtk3_cBoxed,
+        RBoxed,
+        &gtk3_boxed_type,
+        rboxed
+    );
+
+    rboxed->type  = type;
+    rboxed->boxed = g_boxed_copy(type, boxed);
+
+    return rbboxed;
+}
+
+/**
+ * Returns the boxed value stored in an instance of {Gtk3::Boxed}.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] rbboxed The Ruby object.
+ * @param  [GType] type The expected type of the boxed value.
+ * @raise  [TypeError] Raised when the object is not a {Gtk3::Boxed} or
+ *  contains a value of a different type.
+ * @return [gpointer]
+ */
+gpointer gtk3_boxed_unwrap(VALUE rbboxed, GType type)
+{
+    RBoxed *rboxed;
+
+    TypedData_Get_Struct(rbboxed, RBoxed, &gtk3_boxed_type, rboxed);
+
+    if ( !g_type_is_a(rboxed->type, type) )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong boxed type %s (expected %s)",
+            g_type_name(rboxed->type),
+            g_type_name(type)
+        );
+    }
+
+    return rboxed->boxed;
+}
+
+/**
+ * Returns the name of the GType of the boxed value.
+ *
+ * @since  2026-10-19
+ * @return [String]
+ */
+static VALUE gtk3_boxed_type_name(VALUE self)
+{
+    RBoxed *rboxed;
+
+    TypedData_Get_Struct(self, RBoxed, &gtk3_boxed_type, rboxed);
+
+    return rb_str_new2(g_type_name(rboxed->type));
+}
+
+/**
+ * Sets up the {Gtk3::Boxed} class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_boxed()
+{
+    gtk3_cBoxed = rb_define_class_under(gtk3_mGtk3, "Boxed", rb_cObject);
+
+    rb_undef_alloc_func(gtk3_cBoxed);
+
+    rb_define_method(gtk3_cBoxed, "type_name", gtk3_boxed_type_name, 0);
+}
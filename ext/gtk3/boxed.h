@@ -0,0 +1,28 @@
+#ifndef GTK3_BOXED
+#define GTK3_BOXED
+
+#include "gtk3.h"
+
+/**
+ * Structure used by {Gtk3::Boxed} for storing a boxed value. This structure
+ * has the following members:
+ *
+ * * type: the GType of the boxed value.
+ * * boxed: the boxed value.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RBoxed
+{
+    GType type;
+    gpointer boxed;
+} RBoxed;
+
+extern VALUE gtk3_cBoxed;
+
+extern VALUE gtk3_boxed_wrap(GType type, gconstpointer boxed);
+extern gpointer gtk3_boxed_unwrap(VALUE rbboxed, GType type);
+
+extern void Init_gtk3_boxed();
+
+#endif
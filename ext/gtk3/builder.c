@@ -0,0 +1,421 @@
+#include "builder.h"
+
+/**
+ * Document-class: Gtk3::Builder
+ *
+ * {Gtk3::Builder} creates widgets from UI definitions in the GtkBuilder XML
+ * format. Definitions can be loaded from Strings, files or resources, after
+ * which signals can be connected to the methods of a handler object.
+ *
+ * @example
+ *  builder = Gtk3::Builder.new.add_from_file('main.ui')
+ *
+ *  builder.connect_signals(MainWindowHandler.new)
+ *
+ *  builder['main_window'].show_all
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cBuilder;
+
+/**
+ * Structure used by {Gtk3::Builder#connect_signals} for the signals that are
+ * being connected.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RBuilderConnect
+{
+    VALUE handler;
+    GArray *signals;
+} RBuilderConnect;
+
+/* Helper methods */
+
+/**
+ * Called by gtk_builder_connect_signals_full() for every signal defined in
+ * the UI definitions. The signals are only collected here, they're connected
+ * once GTK is done iterating so that no Ruby code runs (and no exceptions are
+ * raised) while GTK is iterating.
+ *
+ * @since 2026-10-19
+ * @param [GtkBuilder *] builder The builder.
+ * @param [GObject *] object The object to connect the signal to.
+ * @param [const gchar *] signal The name of the signal.
+ * @param [const gchar *] handler The name of the handler.
+ * @param [GObject *] connect_object The object to pass to the handler, or
+ *  NULL.
+ * @param [GConnectFlags] flags The connect flags.
+ * @param [gpointer] data The GArray to add the signal to.
+ */
+static void gtk3_builder_collect_signal(
+    GtkBuilder *builder,
+    GObject *object,
+    const gchar *signal,
+    const gchar *handler,
+    GObject *connect_object,
+    GConnectFlags flags,
+    gpointer data
+)
+{
+    RBuilderSignal entry;
+
+    entry.object         = g_object_ref(object);
+    entry.signal         = g_strdup(signal);
+    entry.handler        = g_strdup(handler);
+    entry.connect_object = connect_object ? g_object_ref(connect_object) : NULL;
+    entry.flags          = flags;
+
+    g_array_append_val((GArray *) data, entry);
+}
+
+/**
+ * Resolves the methods of all collected signals and connects them. Every
+ * handler name is resolved once, all methods are resolved before the first
+ * signal is connected.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RBuilderConnect of the call.
+ * @return [VALUE]
+ */
+static VALUE gtk3_builder_connect_collected(VALUE data)
+{
+    guint index;
+    VALUE name;
+    VALUE method;
+    VALUE methods;
+    VALUE cache;
+    RBuilderSignal *entry;
+    RClosure *closure;
+    RBuilderConnect *connect = (RBuilderConnect *) data;
+
+    methods = rb_ary_new2(connect->signals->len);
+    cache   = rb_hash_new();
+
+    for ( index = 0; index < connect->signals->len; index++ )
+    {
+        entry  = &g_array_index(connect->signals, RBuilderSignal, index);
+        name   = gtk3_utf8_intern(entry->handler);
+        method = rb_hash_lookup2(cache, name, Qundef);
+
+        if ( method == Qundef )
+        {
+            method = rb_obj_method(connect->handler, name);
+
+            rb_hash_aset(cache, name, method);
+        }
+
+        rb_ary_push(methods, method);
+    }
+
+    for ( index = 0; index < connect->signals->len; index++ )
+    {
+        entry   = &g_array_index(connect->signals, RBuilderSignal, index);
+        closure = gtk3_closure_new(
+            rb_ary_entry(methods, index),
+            entry->connect_object
+        );
+
+        g_signal_connect_closure(
+            entry->object,
+            entry->signal,
+            (GClosure *) closure,
+            (entry->flags & G_CONNECT_AFTER) != 0
+        );
+    }
+
+    return Qnil;
+}
+
+/**
+ * Releases the collected signals.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RBuilderConnect of the call.
+ * @return [VALUE]
+ */
+static VALUE gtk3_builder_free_collected(VALUE data)
+{
+    guint index;
+    RBuilderSignal *entry;
+    RBuilderConnect *connect = (RBuilderConnect *) data;
+
+    for ( index = 0; index < connect->signals->len; index++ )
+    {
+        entry = &g_array_index(connect->signals, RBuilderSignal, index);
+
+        g_object_unref(entry->object);
+
+        if ( entry->connect_object )
+        {
+            g_object_unref(entry->connect_object);
+        }
+
+        g_free(entry->signal);
+        g_free(entry->handler);
+    }
+
+    g_array_free(connect->signals, TRUE);
+
+    return Qnil;
+}
+
+/* Class methods */
+
+/**
+ * Creates a new, empty builder.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_builder_new(VALUE class)
+{
+    VALUE rb_builder;
+
+    gtk3_ensure_init();
+
+    rb_builder = gtk3_object_wrap(class, gtk_builder_new(), TRUE);
+
+    rb_obj_call_init(rb_builder, 0, NULL);
+
+    return rb_builder;
+}
+
+/* Instance methods */
+
+/**
+ * Adds the objects defined in a String containing a UI definition.
+ *
+ * @example
+ *  builder.add_from_string(File.read('main.ui'))
+ *
+ * @since  2026-10-19
+ * @param  [String] definition The UI definition.
+ * @raise  [Gtk3::Error] Raised when the definition is invalid.
+ * @return [Gtk3::Builder]
+ */
+static VALUE gtk3_builder_add_from_string(VALUE self, VALUE definition)
+{
+    GtkBuilder *builder;
+    const gchar *text;
+    GError *error = NULL;
+
+    Data_Get_Struct(self, GtkBuilder, builder);
+
+    text = gtk3_string_value_utf8(&definition);
+
+    if ( !gtk_builder_add_from_string(
+        builder,
+        text,
+        RSTRING_LEN(definition),
+        &error
+    ) )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return self;
+}
+
+/**
+ * Adds the objects defined in a UI definition file. Paths starting with
+ * `resource://` are loaded from the registered resource bundles.
+ *
+ * @example
+ *  builder.add_from_file('main.ui')
+ *  builder.add_from_file('resource:///com/example/app/dialog.ui')
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the file.
+ * @raise  [IOError] Raised when the file couldn't be read.
+ * @raise  [Gtk3::Error] Raised when the definition is invalid.
+ * @return [Gtk3::Builder]
+ */
+static VALUE gtk3_builder_add_from_file(VALUE self, VALUE path)
+{
+    GtkBuilder *builder;
+    const gchar *resource;
+    gboolean added;
+    GError *error = NULL;
+
+    Check_Type(path, T_STRING);
+
+    Data_Get_Struct(self, GtkBuilder, builder);
+
+    resource = gtk3_resource_path(StringValueCStr(path));
+
+    if ( resource )
+    {
+        added = gtk_builder_add_from_resource(builder, resource, &error);
+    }
+    else
+    {
+        added = gtk_builder_add_from_file(
+            builder,
+            StringValueCStr(path),
+            &error
+        );
+    }
+
+    if ( !added )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return self;
+}
+
+/**
+ * Adds the objects defined in a UI definition stored in a registered
+ * resource. Both plain resource paths and `resource://` URIs are accepted.
+ *
+ * @example
+ *  builder.add_from_resource('/com/example/app/main.ui')
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the resource.
+ * @raise  [IOError] Raised when the resource doesn't exist.
+ * @raise  [Gtk3::Error] Raised when the definition is invalid.
+ * @return [Gtk3::Builder]
+ */
+static VALUE gtk3_builder_add_from_resource(VALUE self, VALUE path)
+{
+    GtkBuilder *builder;
+    const gchar *resource;
+    GError *error = NULL;
+
+    Data_Get_Struct(self, GtkBuilder, builder);
+
+    resource = gtk3_string_value_utf8(&path);
+
+    if ( gtk3_resource_path(resource) )
+    {
+        resource = gtk3_resource_path(resource);
+    }
+
+    if ( !gtk_builder_add_from_resource(builder, resource, &error) )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return self;
+}
+
+/**
+ * Returns the object with the given ID, or `nil` if no such object exists.
+ * Existing Ruby objects are reused.
+ *
+ * @example
+ *  builder['main_window'].show_all
+ *
+ * @since  2026-10-19
+ * @param  [String|Symbol] name The ID of the object.
+ * @return [Gtk3::Object|NilClass]
+ */
+static VALUE gtk3_builder_get_object(VALUE self, VALUE name)
+{
+    GtkBuilder *builder;
+
+    Data_Get_Struct(self, GtkBuilder, builder);
+
+    if ( SYMBOL_P(name) )
+    {
+        name = rb_sym_to_s(name);
+    }
+
+    return gtk3_object_wrap(
+        Qnil,
+        gtk_builder_get_object(builder, gtk3_string_value_utf8(&name)),
+        FALSE
+    );
+}
+
+/**
+ * Connects the signals defined in the UI definitions to the methods of the
+ * handler object. Each method is called with the object that emitted the
+ * signal, or the object specified in the "object" attribute of the signal.
+ * All handler methods are resolved before any signal is connected, each
+ * handler name is only resolved once regardless of how many signals use it.
+ *
+ * @example
+ *  class Handler
+ *    def on_quit_clicked(button)
+ *      Gtk3.main_quit
+ *    end
+ *  end
+ *
+ *  builder.connect_signals(Handler.new)
+ *
+ * @since  2026-10-19
+ * @param  [Object] handler The object that handles the signals.
+ * @raise  [NameError] Raised when the handler lacks a method.
+ * @return [Gtk3::Builder]
+ */
+static VALUE gtk3_builder_connect_signals(VALUE self, VALUE handler)
+{
+    GtkBuilder *builder;
+    RBuilderConnect connect;
+
+    Data_Get_Struct(self, GtkBuilder, builder);
+
+    connect.handler = handler;
+    connect.signals = g_array_new(FALSE, FALSE, sizeof(RBuilderSignal));
+
+    gtk_builder_connect_signals_full(
+        builder,
+        gtk3_builder_collect_signal,
+        connect.signals
+    );
+
+    rb_ensure(
+        gtk3_builder_connect_collected,
+        (VALUE) &connect,
+        gtk3_builder_free_collected,
+        (VALUE) &connect
+    );
+
+    return self;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_builder()
+{
+    gtk3_cBuilder = rb_define_class_under(gtk3_mGtk3, "Builder", gtk3_cObject);
+
+    gtk3_object_register_class(GTK_TYPE_BUILDER, gtk3_cBuilder);
+
+    rb_define_singleton_method(gtk3_cBuilder, "new", gtk3_builder_new, 0);
+
+    rb_define_method(
+        gtk3_cBuilder,
+        "add_from_string",
+        gtk3_builder_add_from_string,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cBuilder,
+        "add_from_file",
+        gtk3_builder_add_from_file,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cBuilder,
+        "add_from_resource",
+        gtk3_builder_add_from_resource,
+        1
+    );
+
+    rb_define_method(gtk3_cBuilder, "[]", gtk3_builder_get_object, 1);
+
+    rb_define_method(
+        gtk3_cBuilder,
+        "connect_signals",
+        gtk3_builder_connect_signals,
+        1
+    );
+}
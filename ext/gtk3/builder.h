@@ -0,0 +1,32 @@
+#ifndef GTK3_BUILDER
+#define GTK3_BUILDER
+
+#include "gtk3.h"
+
+/**
+ * Structure containing a signal that should be connected by
+ * {Gtk3::Builder#connect_signals}.
+ *
+ * * object: the object to connect the signal to.
+ * * signal: the name of the signal, including the detail.
+ * * handler: the name of the method that handles the signal.
+ * * connect_object: the object to pass to the method instead of the object
+ *   emitting the signal, or NULL.
+ * * flags: the connect flags of the signal.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RBuilderSignal
+{
+    GObject *object;
+    gchar *signal;
+    gchar *handler;
+    GObject *connect_object;
+    GConnectFlags flags;
+} RBuilderSignal;
+
+extern VALUE gtk3_cBuilder;
+
+extern void Init_gtk3_builder();
+
+#endif
@@ -0,0 +1,166 @@
+#include "bytes.h"
+
+/**
+ * Hash table containing the frozen Strings that are used as the data of a
+ * GBytes, mapped to the amount of GBytes using them. These Strings are marked
+ * by gtk3_bytes_strings_keeper.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_bytes_strings;
+
+/**
+ * Mutex for gtk3_bytes_strings. A GBytes may be released from any thread.
+ *
+ * @since 2026-10-19
+ */
+static GMutex gtk3_bytes_strings_lock;
+
+/**
+ * Hidden Ruby object that marks the Strings in gtk3_bytes_strings.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_bytes_strings_keeper;
+
+/**
+ * Marks the Strings used by GBytes created using gtk3_rbstring_to_bytes().
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_bytes_strings_mark(void *data)
+{
+    GHashTableIter iter;
+    gpointer string;
+
+    g_mutex_lock(&gtk3_bytes_strings_lock);
+
+    g_hash_table_iter_init(&iter, gtk3_bytes_strings);
+
+    while ( g_hash_table_iter_next(&iter, &string, NULL) )
+    {
+        rb_gc_mark((VALUE) string);
+    }
+
+    g_mutex_unlock(&gtk3_bytes_strings_lock);
+}
+
+/**
+ * Called when a GBytes created using gtk3_rbstring_to_bytes() is freed. This
+ * function doesn't call into Ruby as it may be called from any thread.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The String used by the GBytes.
+ */
+static void gtk3_bytes_release(gpointer data)
+{
+    guint count;
+
+    g_mutex_lock(&gtk3_bytes_strings_lock);
+
+    count = GPOINTER_TO_UINT(g_hash_table_lookup(gtk3_bytes_strings, data));
+
+    if ( count <= 1 )
+    {
+        g_hash_table_remove(gtk3_bytes_strings, data);
+    }
+    else
+    {
+        g_hash_table_insert(
+            gtk3_bytes_strings,
+            data,
+            GUINT_TO_POINTER(count - 1)
+        );
+    }
+
+    g_mutex_unlock(&gtk3_bytes_strings_lock);
+}
+
+/**
+ * Returns a frozen String containing a copy of the data of a GBytes.
+ *
+ * The data is copied into a buffer owned by Ruby instead of being shared.
+ * Ruby treats the buffer of a static String as immortal and hands it out to
+ * copies and substrings without keeping the original String (and thus the
+ * GBytes) alive, which would leave those pointing at freed memory.
+ *
+ * @since  2026-10-19
+ * @param  [GBytes *] bytes The GBytes to convert.
+ * @return [VALUE]
+ */
+VALUE gtk3_bytes_to_rbstring(GBytes *bytes)
+{
+    gsize size;
+    gconstpointer data;
+
+    if ( bytes == NULL )
+    {
+        return Qnil;
+    }
+
+    data = g_bytes_get_data(bytes, &size);
+
+    return rb_obj_freeze(rb_str_new(data, size));
+}
+
+/**
+ * Returns a GBytes containing the data of a String. The data of frozen
+ * Strings is used directly, the String is kept alive until the GBytes is
+ * freed. The data of other Strings is copied as it may still change.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] string The String to convert.
+ * @return [GBytes *]
+ */
+GBytes *gtk3_rbstring_to_bytes(VALUE string)
+{
+    guint count;
+
+    Check_Type(string, T_STRING);
+
+    if ( !OBJ_FROZEN(string) )
+    {
+        return g_bytes_new(RSTRING_PTR(string), RSTRING_LEN(string));
+    }
+
+    g_mutex_lock(&gtk3_bytes_strings_lock);
+
+    count = GPOINTER_TO_UINT(
+        g_hash_table_lookup(gtk3_bytes_strings, (gpointer) string)
+    );
+
+    g_hash_table_insert(
+        gtk3_bytes_strings,
+        (gpointer) string,
+        GUINT_TO_POINTER(count + 1)
+    );
+
+    g_mutex_unlock(&gtk3_bytes_strings_lock);
+
+    return g_bytes_new_with_free_func(
+        RSTRING_PTR(string),
+        RSTRING_LEN(string),
+        gtk3_bytes_release,
+        (gpointer) string
+    );
+}
+
+/**
+ * Sets up the variables used by the GBytes bridge.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_bytes()
+{
+    gtk3_bytes_strings = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk3_bytes_strings_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_bytes_strings_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_bytes_strings_keeper);
+}
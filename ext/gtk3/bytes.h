@@ -0,0 +1,11 @@
+#ifndef GTK3_BYTES
+#define GTK3_BYTES
+
+#include "gtk3.h"
+
+extern VALUE gtk3_bytes_to_rbstring(GBytes *bytes);
+extern GBytes *gtk3_rbstring_to_bytes(VALUE string);
+
+extern void Init_gtk3_bytes();
+
+#endif
@@ -1,8 +1,21 @@
 #include "closure.h"
 
 /**
- * Called whenever a closure is no longer valid. This function unsets the
- * contents of the RClosure struct and frees any allocated memory.
+ * Structure used for a single call of a closure's proc.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RClosureCall
+{
+    RClosure *closure;
+    GValue *return_value;
+    const GValue *instance;
+} RClosureCall;
+
+/**
+ * Called whenever a closure is no longer valid. This function unregisters the
+ * proc of the RClosure struct so that the GC no longer scans the memory of
+ * the closure once it has been freed.
  *
  * @since 2012-06-03
  * @param [gpointer] data Custom data that was passed to the closure.
@@ -10,13 +23,76 @@
  */
 void gtk3_closure_invalidate(gpointer data, GClosure *closure)
 {
-    /* RClosure *rclosure = (RClosure *) closure; */
+    RClosure *rclosure = (RClosure *) closure;
+
+    rb_gc_unregister_address(&rclosure->proc);
+
+    rclosure->proc   = Qnil;
+    rclosure->object = NULL;
+}
+
+/**
+ * Calls the proc of a closure and converts its return value. Used by
+ * gtk3_closure_marshal().
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RClosureCall of the call.
+ * @return [VALUE]
+ */
+static VALUE gtk3_closure_call(VALUE data)
+{
+    VALUE object;
+    VALUE rb_return_value;
+    RClosureCall *call   = (RClosureCall *) data;
+    GValue *return_value = call->return_value;
+
+    if ( call->closure->object != NULL )
+    {
+        object = gtk3_object_wrap(Qnil, call->closure->object, FALSE);
+    }
+    else if ( call->instance != NULL )
+    {
+        object = gtk3_gvalue_to_rbvalue(call->instance);
+    }
+    else
+    {
+        object = Qnil;
+    }
+
+    rb_return_value = rb_funcall(
+        call->closure->proc,
+        gtk3_id_call,
+        1,
+        object
+    );
+
+    /* Signals such as "destroy" don't have a return value. */
+    if ( return_value == NULL || G_VALUE_TYPE(return_value) == G_TYPE_INVALID )
+    {
+        return Qnil;
+    }
 
-    /* TODO: Figure out how to effectively use this function to free memory. */
+    /*
+    Blocks often return nil (or some other object) for signals that expect a
+    boolean, these are converted based on their truthiness.
+    */
+    if ( G_VALUE_HOLDS_BOOLEAN(return_value) )
+    {
+        g_value_set_boolean(return_value, RTEST(rb_return_value));
+    }
+    else
+    {
+        gtk3_rbvalue_to_gvalue(rb_return_value, return_value);
+    }
+
+    return Qnil;
 }
 
 /**
- * Marshal function that is executed whenever an event is triggered.
+ * Marshal function that is executed whenever an event is triggered. The proc
+ * is called with the object given to gtk3_closure_new() or, if none was
+ * given, the instance that emitted the signal. Exceptions are raised once
+ * control returns to Ruby, see gtk3_protect().
  *
  * @since 2012-06-03
  * @param [GClosure] closure The closure for the event.
@@ -37,28 +113,32 @@ void gtk3_closure_marshal(
     gpointer marshal_data
 )
 {
-    VALUE rb_return_value;
-    RClosure *rclosure = (RClosure *) closure;
+    RClosureCall call;
 
-    rb_return_value = rb_funcall(
-        rclosure->proc,
-        gtk3_id_call,
-        1,
-        rclosure->object
-    );
+    call.closure      = (RClosure *) closure;
+    call.return_value = return_value;
+    call.instance     = n_param_values > 0 ? &param_values[0] : NULL;
 
-    gtk3_rbvalue_to_gvalue(rb_return_value, return_value);
+    if ( NIL_P(call.closure->proc) )
+    {
+        return;
+    }
+
+    gtk3_protect(gtk3_closure_call, (VALUE) &call);
 }
 
 /**
- * Creates a new RClosure object.
+ * Creates a new RClosure object. Only the proc is kept alive by the closure,
+ * the object is watched and the closure is invalidated once the object is
+ * disposed.
  *
  * @since  2012-06-03
  * @param  [VALUE] proc The proc to call whenever an event is triggered.
- * @param  [VALUE] object The object that the closure and proc belong to.
+ * @param  [gpointer] object The GObject to pass to the proc, or NULL to pass
+ *  the instance that emitted the signal.
  * @return [RClosure]
  */
-RClosure *gtk3_closure_new(VALUE proc, VALUE object)
+RClosure *gtk3_closure_new(VALUE proc, gpointer object)
 {
     GClosure *closure;
     RClosure *rclosure;
@@ -74,5 +154,28 @@ RClosure *gtk3_closure_new(VALUE proc, VALUE object)
 
     rb_global_variable(&rclosure->proc);
 
+    if ( object != NULL )
+    {
+        g_object_watch_closure(object, closure);
+    }
+
     return rclosure;
 }
+
+/**
+ * Returns the proc of a closure created using gtk3_closure_new(), or nil for
+ * closures created by other code.
+ *
+ * @since  2026-10-19
+ * @param  [GClosure *] closure The closure.
+ * @return [VALUE]
+ */
+VALUE gtk3_closure_proc(GClosure *closure)
+{
+    if ( closure == NULL || closure->marshal != gtk3_closure_marshal )
+    {
+        return Qnil;
+    }
+
+    return ((RClosure *) closure)->proc;
+}
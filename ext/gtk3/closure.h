@@ -9,7 +9,8 @@
  *
  * * closure
  * * proc: the proc to call.
- * * object: the Ruby object of the event.
+ * * object: the GObject to pass to the proc, or NULL to pass the instance
+ *   that emitted the signal.
  *
  * @since 2012-06-03
  */
@@ -17,7 +18,7 @@ typedef struct RClosure
 {
     GClosure closure;
     VALUE proc;
-    VALUE object;
+    gpointer object;
 } RClosure;
 
 extern void gtk3_closure_invalidate(gpointer data, GClosure *closure);
@@ -31,6 +32,7 @@ extern void gtk3_closure_marshal(
     gpointer marshal_data
 );
 
-extern RClosure *gtk3_closure_new(VALUE proc, VALUE object);
+extern RClosure *gtk3_closure_new(VALUE proc, gpointer object);
+extern VALUE gtk3_closure_proc(GClosure *closure);
 
 #endif
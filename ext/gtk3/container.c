@@ -0,0 +1,343 @@
+#include "container.h"
+
+/**
+ * Document-class: Gtk3::Container
+ *
+ * {Gtk3::Container} is the base class of widgets that contain other widgets,
+ * such as {Gtk3::Window}, {Gtk3::Box} and {Gtk3::Grid}.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cContainer;
+
+/**
+ * Structure used by {Gtk3::Container#add_all} for the children that are
+ * being added.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RContainerBatch
+{
+    GtkWidget *container;
+    VALUE children;
+    GPtrArray *widgets;
+    GHashTable *seen;
+} RContainerBatch;
+
+/* Helper methods */
+
+/**
+ * Raises an ArgumentError for a child that can't be added to a container.
+ *
+ * @since 2026-10-19
+ * @param [long] index The index of the child or -1 for a single child.
+ * @param [const char *] reason The reason the child can't be added.
+ */
+static void gtk3_container_reject_child(long index, const char *reason)
+{
+    if ( index < 0 )
+    {
+        rb_raise(rb_eArgError, "the child %s", reason);
+    }
+
+    rb_raise(rb_eArgError, "the child at index %ld %s", index, reason);
+}
+
+/**
+ * Returns the widget wrapped by a Ruby object that is about to be added to a
+ * container. Errors are raised before a container is modified so that bulk
+ * insertions either add all children or none.
+ *
+ * @since  2026-10-19
+ * @param  [GtkWidget *] container The container the child is added to.
+ * @param  [VALUE] child The Ruby object of the child.
+ * @param  [long] index The index of the child in the list of children or -1
+ *  when a single child is added.
+ * @param  [GHashTable *] seen Set of the children checked so far or NULL
+ *  when a single child is added.
+ * @raise  [TypeError] Raised when the child isn't a widget.
+ * @raise  [ArgumentError] Raised when the child already has a parent, is a
+ *  toplevel window, is specified more than once or is added to a bin that
+ *  already has a child.
+ * @return [GtkWidget *]
+ */
+GtkWidget *gtk3_container_check_child(
+    GtkWidget *container,
+    VALUE child,
+    long index,
+    GHashTable *seen
+)
+{
+    GtkWidget *widget = gtk3_object_unwrap(child, GTK_TYPE_WIDGET);
+
+    if ( widget == container || gtk_widget_get_parent(widget) )
+    {
+        gtk3_container_reject_child(index, "has a parent");
+    }
+
+    if ( gtk_widget_is_toplevel(widget) )
+    {
+        gtk3_container_reject_child(index, "is a toplevel window");
+    }
+
+    if ( seen && g_hash_table_contains(seen, widget) )
+    {
+        gtk3_container_reject_child(index, "is a duplicate");
+    }
+
+    if ( GTK_IS_BIN(container) && (gtk_bin_get_child(GTK_BIN(container))
+        || (seen && g_hash_table_size(seen) > 0)) )
+    {
+        gtk3_container_reject_child(index, "doesn't fit in a bin with a child");
+    }
+
+    if ( seen )
+    {
+        g_hash_table_add(seen, widget);
+    }
+
+    return widget;
+}
+
+/**
+ * Freezes the property notifications of a container and the child property
+ * notifications of the children that are about to be added, so that all
+ * notifications are emitted once the children have been added.
+ *
+ * @since 2026-10-19
+ * @param [GtkWidget *] container The container.
+ * @param [GPtrArray *] children The children that are about to be added.
+ */
+void gtk3_container_freeze(GtkWidget *container, GPtrArray *children)
+{
+    guint index;
+
+    g_object_freeze_notify(G_OBJECT(container));
+
+    for ( index = 0; index < children->len; index++ )
+    {
+        gtk_widget_freeze_child_notify(g_ptr_array_index(children, index));
+    }
+}
+
+/**
+ * Thaws the notifications frozen using gtk3_container_freeze() and queues a
+ * single resize of the container.
+ *
+ * @since 2026-10-19
+ * @param [GtkWidget *] container The container.
+ * @param [GPtrArray *] children The children that were added.
+ */
+void gtk3_container_thaw(GtkWidget *container, GPtrArray *children)
+{
+    guint index;
+
+    for ( index = 0; index < children->len; index++ )
+    {
+        gtk_widget_thaw_child_notify(g_ptr_array_index(children, index));
+    }
+
+    g_object_thaw_notify(G_OBJECT(container));
+
+    gtk_widget_queue_resize(container);
+}
+
+/**
+ * Checks all children of a bulk insertion and adds them to the container.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RContainerBatch of the insertion.
+ * @return [VALUE]
+ */
+static VALUE gtk3_container_add_batch(VALUE data)
+{
+    long index;
+    RContainerBatch *batch = (RContainerBatch *) data;
+
+    for ( index = 0; index < RARRAY_LEN(batch->children); index++ )
+    {
+        g_ptr_array_add(
+            batch->widgets,
+            gtk3_container_check_child(
+                batch->container,
+                rb_ary_entry(batch->children, index),
+                index,
+                batch->seen
+            )
+        );
+    }
+
+    gtk3_container_freeze(batch->container, batch->widgets);
+
+    for ( index = 0; index < (long) batch->widgets->len; index++ )
+    {
+        gtk_container_add(
+            GTK_CONTAINER(batch->container),
+            g_ptr_array_index(batch->widgets, index)
+        );
+    }
+
+    gtk3_container_thaw(batch->container, batch->widgets);
+
+    return Qnil;
+}
+
+/**
+ * Frees the native data of a bulk insertion.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RContainerBatch of the insertion.
+ * @return [VALUE]
+ */
+static VALUE gtk3_container_free_batch(VALUE data)
+{
+    RContainerBatch *batch = (RContainerBatch *) data;
+
+    g_ptr_array_free(batch->widgets, TRUE);
+    g_hash_table_destroy(batch->seen);
+
+    return Qnil;
+}
+
+/* Instance methods */
+
+/**
+ * Adds a widget to the container.
+ *
+ * @example
+ *  window.add(Gtk3.create(:GtkLabel, :label => 'Hello'))
+ *
+ * @since  2026-10-19
+ * @param  [Gtk3::Widget] child The widget to add.
+ * @raise  [ArgumentError] Raised when the widget already has a parent, is a
+ *  toplevel window or is added to a bin that already has a child.
+ * @return [Gtk3::Container]
+ */
+static VALUE gtk3_container_add(VALUE self, VALUE child)
+{
+    GtkWidget *container;
+    GtkWidget *widget;
+
+    Data_Get_Struct(self, GtkWidget, container);
+
+    widget = gtk3_container_check_child(container, child, -1, NULL);
+
+    gtk_container_add(GTK_CONTAINER(container), widget);
+
+    return self;
+}
+
+/**
+ * Adds all the widgets in the Array to the container using a single native
+ * call. Notifications are emitted and a resize is queued once all widgets
+ * have been added. If any of the widgets can't be added none are added.
+ *
+ * @example
+ *  box.add_all(labels)
+ *
+ * @since  2026-10-19
+ * @param  [Array] children The widgets to add.
+ * @raise  [TypeError] Raised when a child isn't a widget.
+ * @raise  [ArgumentError] Raised when a child already has a parent, is a
+ *  toplevel window, is specified more than once or doesn't fit in a bin.
+ * @return [Gtk3::Container]
+ */
+static VALUE gtk3_container_add_all(VALUE self, VALUE children)
+{
+    RContainerBatch batch;
+
+    Check_Type(children, T_ARRAY);
+
+    Data_Get_Struct(self, GtkWidget, batch.container);
+
+    batch.children = children;
+    batch.widgets  = g_ptr_array_sized_new(RARRAY_LEN(children));
+    batch.seen     = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    rb_ensure(
+        gtk3_container_add_batch,
+        (VALUE) &batch,
+        gtk3_container_free_batch,
+        (VALUE) &batch
+    );
+
+    return self;
+}
+
+/**
+ * Removes a child from the container.
+ *
+ * @since  2026-10-19
+ * @param  [Gtk3::Widget] child The widget to remove.
+ * @raise  [ArgumentError] Raised when the widget isn't a child of the
+ *  container.
+ * @return [Gtk3::Container]
+ */
+static VALUE gtk3_container_remove(VALUE self, VALUE child)
+{
+    GtkWidget *container;
+    GtkWidget *widget;
+
+    Data_Get_Struct(self, GtkWidget, container);
+
+    widget = gtk3_object_unwrap(child, GTK_TYPE_WIDGET);
+
+    if ( gtk_widget_get_parent(widget) != container )
+    {
+        rb_raise(rb_eArgError, "the widget isn't a child of the container");
+    }
+
+    gtk_container_remove(GTK_CONTAINER(container), widget);
+
+    return self;
+}
+
+/**
+ * Returns the direct children of the container.
+ *
+ * @since  2026-10-19
+ * @return [Array]
+ */
+static VALUE gtk3_container_children(VALUE self)
+{
+    GtkWidget *container;
+    GList *children;
+    GList *child;
+    VALUE rb_children;
+
+    Data_Get_Struct(self, GtkWidget, container);
+
+    children    = gtk_container_get_children(GTK_CONTAINER(container));
+    rb_children = rb_ary_new2(g_list_length(children));
+
+    /* Wrapping can't drop the children, the container references them. */
+    for ( child = children; child != NULL; child = child->next )
+    {
+        rb_ary_push(rb_children, gtk3_object_wrap(Qnil, child->data, FALSE));
+    }
+
+    g_list_free(children);
+
+    return rb_children;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_container()
+{
+    gtk3_cContainer = rb_define_class_under(
+        gtk3_mGtk3,
+        "Container",
+        gtk3_cWidget
+    );
+
+    gtk3_object_register_class(GTK_TYPE_CONTAINER, gtk3_cContainer);
+
+    rb_define_method(gtk3_cContainer, "add", gtk3_container_add, 1);
+    rb_define_method(gtk3_cContainer, "add_all", gtk3_container_add_all, 1);
+    rb_define_method(gtk3_cContainer, "remove", gtk3_container_remove, 1);
+    rb_define_method(gtk3_cContainer, "children", gtk3_container_children, 0);
+}
@@ -0,0 +1,20 @@
+#ifndef GTK3_CONTAINER
+#define GTK3_CONTAINER
+
+#include "gtk3.h"
+
+extern VALUE gtk3_cContainer;
+
+extern GtkWidget *gtk3_container_check_child(
+    GtkWidget *container,
+    VALUE child,
+    long index,
+    GHashTable *seen
+);
+
+extern void gtk3_container_freeze(GtkWidget *container, GPtrArray *children);
+extern void gtk3_container_thaw(GtkWidget *container, GPtrArray *children);
+
+extern void Init_gtk3_container();
+
+#endif
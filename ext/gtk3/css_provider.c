@@ -0,0 +1,510 @@
+#include "css_provider.h"
+
+/**
+ * Document-class: Gtk3::CssProvider
+ *
+ * {Gtk3::CssProvider} loads style sheets that can be applied to all widgets
+ * of the default screen.
+ *
+ * @example
+ *  provider = Gtk3::CssProvider.new
+ *
+ *  provider.load_async('theme.css') do |result|
+ *    provider.add_to_screen if result == true
+ *  end
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cCssProvider;
+
+/**
+ * Set of RCssLoad structures for loads that haven't completed yet.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_css_provider_loads;
+
+/**
+ * Hidden Ruby object that marks the callbacks in gtk3_css_provider_loads.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_css_provider_loads_keeper;
+
+/* Helper methods */
+
+/**
+ * Marks the callbacks of the loads in gtk3_css_provider_loads.
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_css_provider_loads_mark(void *data)
+{
+    GHashTableIter iter;
+    gpointer load;
+
+    g_hash_table_iter_init(&iter, gtk3_css_provider_loads);
+
+    while ( g_hash_table_iter_next(&iter, &load, NULL) )
+    {
+        rb_gc_mark(((RCssLoad *) load)->callback);
+    }
+}
+
+/**
+ * Returns the default screen.
+ *
+ * @since  2026-10-19
+ * @raise  [RuntimeError] Raised when there's no default screen.
+ * @return [GdkScreen *]
+ */
+static GdkScreen *gtk3_css_provider_screen()
+{
+    GdkScreen *screen;
+
+    gtk3_ensure_init();
+
+    screen = gdk_screen_get_default();
+
+    if ( !screen )
+    {
+        rb_raise(rb_eRuntimeError, "there is no default screen");
+    }
+
+    return screen;
+}
+
+/**
+ * Called by the main loop once the style sheet of a load started by
+ * {Gtk3::CssProvider#load_async} has been read. The style sheet is parsed
+ * here as GTK can only be used from the main thread. The load is released
+ * before the callback is executed. The callback can't raise through the main
+ * loop, exceptions are raised again by {Gtk3.main} or {Gtk3.main\_iteration}
+ * instead.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data The RCssLoad of the load.
+ * @return [gboolean]
+ */
+static gboolean gtk3_css_provider_load_done(gpointer data)
+{
+    RCssLoad *load = (RCssLoad *) data;
+    VALUE callback = load->callback;
+    VALUE result   = Qtrue;
+
+    if ( !load->error )
+    {
+        gtk_css_provider_load_from_data(
+            load->provider,
+            load->contents,
+            load->length,
+            &load->error
+        );
+    }
+
+    if ( load->error )
+    {
+        result = gtk3_error_exception(load->error);
+    }
+
+    g_hash_table_remove(gtk3_css_provider_loads, load);
+
+    g_object_unref(load->provider);
+    g_free(load->contents);
+    g_free(load->path);
+    g_free(load);
+
+    if ( !NIL_P(callback) )
+    {
+        gtk3_call_protected(callback, result);
+    }
+
+    return FALSE;
+}
+
+/**
+ * Reads the style sheet of a load started by {Gtk3::CssProvider#load_async}.
+ * This function runs in a separate thread and doesn't touch any Ruby objects
+ * or GTK widgets. Paths starting with `resource://` are read from the
+ * registered resource bundles.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data The RCssLoad of the load.
+ * @return [gpointer]
+ */
+static gpointer gtk3_css_provider_read(gpointer data)
+{
+    GBytes *bytes;
+    RCssLoad *load        = (RCssLoad *) data;
+    const gchar *resource = gtk3_resource_path(load->path);
+
+    if ( resource )
+    {
+        bytes = g_resources_lookup_data(
+            resource,
+            G_RESOURCE_LOOKUP_FLAGS_NONE,
+            &load->error
+        );
+
+        if ( bytes )
+        {
+            load->contents = g_bytes_unref_to_data(bytes, &load->length);
+        }
+    }
+    else
+    {
+        g_file_get_contents(
+            load->path,
+            &load->contents,
+            &load->length,
+            &load->error
+        );
+    }
+
+    g_idle_add(gtk3_css_provider_load_done, load);
+
+    return NULL;
+}
+
+/* Class methods */
+
+/**
+ * Creates a new, empty provider.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_css_provider_new(VALUE class)
+{
+    VALUE rb_provider = gtk3_object_wrap(class, gtk_css_provider_new(), TRUE);
+
+    rb_obj_call_init(rb_provider, 0, NULL);
+
+    return rb_provider;
+}
+
+/* Instance methods */
+
+/**
+ * Loads a style sheet from a String, replacing the current style sheet.
+ *
+ * @since  2026-10-19
+ * @param  [String] css The style sheet.
+ * @raise  [Gtk3::Error] Raised when the style sheet is invalid.
+ * @return [Gtk3::CssProvider]
+ */
+static VALUE gtk3_css_provider_load_from_data(VALUE self, VALUE css)
+{
+    GtkCssProvider *provider;
+    const gchar *text;
+    GError *error = NULL;
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    text = gtk3_string_value_utf8(&css);
+
+    if ( !gtk_css_provider_load_from_data(
+        provider,
+        text,
+        RSTRING_LEN(css),
+        &error
+    ) )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return self;
+}
+
+/**
+ * Loads a style sheet from a file, replacing the current style sheet. Paths
+ * starting with `resource://` are loaded from the registered resource
+ * bundles.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the style sheet.
+ * @raise  [IOError] Raised when the file couldn't be read.
+ * @raise  [Gtk3::Error] Raised when the style sheet is invalid.
+ * @return [Gtk3::CssProvider]
+ */
+static VALUE gtk3_css_provider_load_from_path(VALUE self, VALUE path)
+{
+    GtkCssProvider *provider;
+    const gchar *resource;
+    GError *error = NULL;
+
+    Check_Type(path, T_STRING);
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    resource = gtk3_resource_path(StringValueCStr(path));
+
+    if ( resource )
+    {
+        gtk_css_provider_load_from_resource(provider, resource);
+
+        return self;
+    }
+
+    if ( !gtk_css_provider_load_from_path(
+        provider,
+        StringValueCStr(path),
+        &error
+    ) )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return self;
+}
+
+/**
+ * Loads a style sheet from a registered resource bundle. GTK doesn't report
+ * errors for style sheets loaded from resources.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path or `resource://` URI of the style sheet.
+ * @return [Gtk3::CssProvider]
+ */
+static VALUE gtk3_css_provider_load_from_resource(VALUE self, VALUE path)
+{
+    GtkCssProvider *provider;
+    const gchar *resource;
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    resource = gtk3_string_value_utf8(&path);
+
+    if ( gtk3_resource_path(resource) )
+    {
+        resource = gtk3_resource_path(resource);
+    }
+
+    gtk_css_provider_load_from_resource(provider, resource);
+
+    return self;
+}
+
+/**
+ * Loads a style sheet from a file without blocking the main loop. The file
+ * is read in a separate thread, after which the style sheet is parsed from
+ * the main loop and the block is called with `true`, an IOError if the file
+ * couldn't be read or a {Gtk3::Error} if the style sheet is invalid. Paths
+ * starting with `resource://` are read from the registered resource bundles.
+ * Exceptions raised by the block are raised by {Gtk3.main} or
+ * {Gtk3.main\_iteration}.
+ *
+ * @example
+ *  provider.load_async('dark.css') do |result|
+ *    warn(result.message) unless result == true
+ *  end
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path or `resource://` URI of the style sheet.
+ * @yieldparam [TrueClass|IOError|Gtk3::Error] result
+ * @return [NilClass]
+ */
+static VALUE gtk3_css_provider_load_async(VALUE self, VALUE path)
+{
+    GtkCssProvider *provider;
+    GThread *thread;
+    RCssLoad *load;
+
+    Check_Type(path, T_STRING);
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    load = g_new0(RCssLoad, 1);
+
+    load->provider = g_object_ref(provider);
+    load->path     = g_strdup(StringValueCStr(path));
+    load->callback = rb_block_given_p() ? rb_block_proc() : Qnil;
+
+    g_hash_table_add(gtk3_css_provider_loads, load);
+
+    thread = g_thread_new("gtk3-css-load", gtk3_css_provider_read, load);
+
+    g_thread_unref(thread);
+
+    return Qnil;
+}
+
+/**
+ * Applies the provider to all widgets of the default screen.
+ *
+ * @since  2026-10-19
+ * @param  [Fixnum] priority The priority of the provider, defaults to
+ *  {Gtk3::CssProvider::PRIORITY_APPLICATION}.
+ * @raise  [RuntimeError] Raised when there's no default screen.
+ * @return [Gtk3::CssProvider]
+ */
+static VALUE gtk3_css_provider_add_to_screen(int argc, VALUE *argv, VALUE self)
+{
+    VALUE priority;
+    GtkCssProvider *provider;
+
+    rb_scan_args(argc, argv, "01", &priority);
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    gtk_style_context_add_provider_for_screen(
+        gtk3_css_provider_screen(),
+        GTK_STYLE_PROVIDER(provider),
+        NIL_P(priority)
+            ? GTK_STYLE_PROVIDER_PRIORITY_APPLICATION
+            : NUM2UINT(priority)
+    );
+
+    return self;
+}
+
+/**
+ * Stops applying the provider to the widgets of the default screen.
+ *
+ * @since  2026-10-19
+ * @raise  [RuntimeError] Raised when there's no default screen.
+ * @return [Gtk3::CssProvider]
+ */
+static VALUE gtk3_css_provider_remove_from_screen(VALUE self)
+{
+    GtkCssProvider *provider;
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    gtk_style_context_remove_provider_for_screen(
+        gtk3_css_provider_screen(),
+        GTK_STYLE_PROVIDER(provider)
+    );
+
+    return self;
+}
+
+/**
+ * Returns the style sheet as a String.
+ *
+ * @since  2026-10-19
+ * @return [String]
+ */
+static VALUE gtk3_css_provider_to_s(VALUE self)
+{
+    GtkCssProvider *provider;
+    gchar *css;
+    VALUE rb_css;
+
+    Data_Get_Struct(self, GtkCssProvider, provider);
+
+    css    = gtk_css_provider_to_string(provider);
+    rb_css = gtk3_utf8_new(css);
+
+    g_free(css);
+
+    return rb_css;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_css_provider()
+{
+    gtk3_cCssProvider = rb_define_class_under(
+        gtk3_mGtk3,
+        "CssProvider",
+        gtk3_cObject
+    );
+
+    gtk3_object_register_class(GTK_TYPE_CSS_PROVIDER, gtk3_cCssProvider);
+
+    gtk3_css_provider_loads = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk3_css_provider_loads_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_css_provider_loads_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_css_provider_loads_keeper);
+
+    rb_define_const(
+        gtk3_cCssProvider,
+        "PRIORITY_FALLBACK",
+        INT2NUM(GTK_STYLE_PROVIDER_PRIORITY_FALLBACK)
+    );
+
+    rb_define_const(
+        gtk3_cCssProvider,
+        "PRIORITY_THEME",
+        INT2NUM(GTK_STYLE_PROVIDER_PRIORITY_THEME)
+    );
+
+    rb_define_const(
+        gtk3_cCssProvider,
+        "PRIORITY_SETTINGS",
+        INT2NUM(GTK_STYLE_PROVIDER_PRIORITY_SETTINGS)
+    );
+
+    rb_define_const(
+        gtk3_cCssProvider,
+        "PRIORITY_APPLICATION",
+        INT2NUM(GTK_STYLE_PROVIDER_PRIORITY_APPLICATION)
+    );
+
+    rb_define_const(
+        gtk3_cCssProvider,
+        "PRIORITY_USER",
+        INT2NUM(GTK_STYLE_PROVIDER_PRIORITY_USER)
+    );
+
+    rb_define_singleton_method(
+        gtk3_cCssProvider,
+        "new",
+        gtk3_css_provider_new,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "load_from_data",
+        gtk3_css_provider_load_from_data,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "load_from_path",
+        gtk3_css_provider_load_from_path,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "load_from_resource",
+        gtk3_css_provider_load_from_resource,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "load_async",
+        gtk3_css_provider_load_async,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "add_to_screen",
+        gtk3_css_provider_add_to_screen,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cCssProvider,
+        "remove_from_screen",
+        gtk3_css_provider_remove_from_screen,
+        0
+    );
+
+    rb_define_method(gtk3_cCssProvider, "to_s", gtk3_css_provider_to_s, 0);
+}
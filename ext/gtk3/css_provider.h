@@ -0,0 +1,33 @@
+#ifndef GTK3_CSS_PROVIDER
+#define GTK3_CSS_PROVIDER
+
+#include "gtk3.h"
+
+/**
+ * Structure used for a pending call to {Gtk3::CssProvider#load_async}. The
+ * worker thread only uses the path, contents, length and error members.
+ *
+ * * provider: the provider to load the style sheet into.
+ * * path: the path of the style sheet.
+ * * contents: the contents of the style sheet once read.
+ * * length: the length of the contents.
+ * * error: the error that occurred while reading the style sheet.
+ * * callback: the block to call once the style sheet has been loaded.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RCssLoad
+{
+    GtkCssProvider *provider;
+    gchar *path;
+    gchar *contents;
+    gsize length;
+    GError *error;
+    VALUE callback;
+} RCssLoad;
+
+extern VALUE gtk3_cCssProvider;
+
+extern void Init_gtk3_css_provider();
+
+#endif
@@ -0,0 +1,62 @@
+#include "error.h"
+
+/**
+ * Document-class: Gtk3::Error
+ *
+ * {Gtk3::Error} is raised when GTK reports an error other than a failing
+ * file or resource operation, such as invalid UI definitions.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_eError;
+
+/**
+ * Returns the Ruby exception for a GError and frees the GError. File, IO and
+ * resource errors are converted to an IOError, all other errors to a
+ * {Gtk3::Error}. This is used for errors that are passed to a block instead
+ * of being raised.
+ *
+ * @since  2026-10-19
+ * @param  [GError *] error The error to convert.
+ * @return [VALUE]
+ */
+VALUE gtk3_error_exception(GError *error)
+{
+    VALUE klass = gtk3_eError;
+    VALUE exception;
+
+    if ( error->domain == G_FILE_ERROR
+    || error->domain == G_IO_ERROR
+    || error->domain == G_RESOURCE_ERROR )
+    {
+        klass = rb_eIOError;
+    }
+
+    exception = rb_exc_new2(klass, error->message);
+
+    g_error_free(error);
+
+    return exception;
+}
+
+/**
+ * Raises a GError as a Ruby exception and frees it. See
+ * gtk3_error_exception() for the classes that are used.
+ *
+ * @since 2026-10-19
+ * @param [GError *] error The error to raise.
+ */
+void gtk3_error_raise(GError *error)
+{
+    rb_exc_raise(gtk3_error_exception(error));
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_error()
+{
+    gtk3_eError = rb_define_class_under(gtk3_mGtk3, "Error", rb_eStandardError);
+}
@@ -0,0 +1,13 @@
+#ifndef GTK3_ERROR
+#define GTK3_ERROR
+
+#include "gtk3.h"
+
+extern VALUE gtk3_eError;
+
+extern VALUE gtk3_error_exception(GError *error);
+extern void gtk3_error_raise(GError *error);
+
+extern void Init_gtk3_error();
+
+#endif
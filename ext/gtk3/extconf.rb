@@ -1,6 +1,7 @@
 require 'mkmf'
 
 have_header('ruby.h')
+have_func('rb_hash_new_capa', 'ruby.h')
 
 have_library('gtk-3', 'gtk_init')
 have_library('gdk-3', 'gdk_init')
@@ -13,4 +14,10 @@ end
 
 $CFLAGS << " " << `pkg-config gtk+-3.0 --cflags`
 
+# GObject Introspection is optional, without it only the hand written bindings
+# are available.
+if pkg_config('gobject-introspection-1.0') and have_library('ffi', 'ffi_call')
+  $defs << '-DHAVE_GI'
+end
+
 create_makefile('gtk3/gtk3')
@@ -0,0 +1,311 @@
+#include "grid.h"
+
+/**
+ * Document-class: Gtk3::Grid
+ *
+ * {Gtk3::Grid} arranges its children in rows and columns.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cGrid;
+
+/**
+ * Structure used by {Gtk3::Grid#attach_all} for the children that are being
+ * attached.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RGridBatch
+{
+    GtkWidget *grid;
+    VALUE specs;
+    GArray *attachments;
+    GPtrArray *widgets;
+    GHashTable *seen;
+} RGridBatch;
+
+/* Helper methods */
+
+/**
+ * Checks the amount of columns and rows a child spans.
+ *
+ * @since 2026-10-19
+ * @param [int] width The amount of columns.
+ * @param [int] height The amount of rows.
+ * @param [long] index The index of the child or -1 for a single child.
+ * @raise [ArgumentError] Raised when the width or height is smaller than 1.
+ */
+static void gtk3_grid_check_size(int width, int height, long index)
+{
+    if ( width >= 1 && height >= 1 )
+    {
+        return;
+    }
+
+    if ( index < 0 )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid size %dx%d (expected at least 1x1)",
+            width,
+            height
+        );
+    }
+
+    rb_raise(
+        rb_eArgError,
+        "invalid size %dx%d at index %ld (expected at least 1x1)",
+        width,
+        height,
+        index
+    );
+}
+
+/**
+ * Parses a single specification passed to {Gtk3::Grid#attach_all}.
+ *
+ * @since 2026-10-19
+ * @param [RGridBatch *] batch The batch the specification belongs to.
+ * @param [long] index The index of the specification.
+ * @param [RGridAttachment *] attachment The attachment to store the child
+ *  and its position in.
+ * @raise [TypeError] Raised when the specification isn't an Array.
+ * @raise [ArgumentError] Raised when the specification has the wrong size or
+ *  the width or height is smaller than 1.
+ */
+static void gtk3_grid_parse_spec(
+    RGridBatch *batch,
+    long index,
+    RGridAttachment *attachment
+)
+{
+    VALUE spec = rb_ary_entry(batch->specs, index);
+    long length;
+
+    Check_Type(spec, T_ARRAY);
+
+    length = RARRAY_LEN(spec);
+
+    if ( length != 3 && length != 5 )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid specification at index %ld (expected "
+            "[child, left, top] or [child, left, top, width, height])",
+            index
+        );
+    }
+
+    attachment->left   = NUM2INT(rb_ary_entry(spec, 1));
+    attachment->top    = NUM2INT(rb_ary_entry(spec, 2));
+    attachment->width  = length == 5 ? NUM2INT(rb_ary_entry(spec, 3)) : 1;
+    attachment->height = length == 5 ? NUM2INT(rb_ary_entry(spec, 4)) : 1;
+
+    gtk3_grid_check_size(attachment->width, attachment->height, index);
+
+    attachment->child = gtk3_container_check_child(
+        batch->grid,
+        rb_ary_entry(spec, 0),
+        index,
+        batch->seen
+    );
+}
+
+/**
+ * Parses all specifications of a bulk insertion and attaches the children.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RGridBatch of the insertion.
+ * @return [VALUE]
+ */
+static VALUE gtk3_grid_attach_batch(VALUE data)
+{
+    long index;
+    RGridAttachment attachment;
+    RGridAttachment *current;
+    RGridBatch *batch = (RGridBatch *) data;
+
+    for ( index = 0; index < RARRAY_LEN(batch->specs); index++ )
+    {
+        gtk3_grid_parse_spec(batch, index, &attachment);
+
+        g_array_append_val(batch->attachments, attachment);
+        g_ptr_array_add(batch->widgets, attachment.child);
+    }
+
+    gtk3_container_freeze(batch->grid, batch->widgets);
+
+    for ( index = 0; index < (long) batch->attachments->len; index++ )
+    {
+        current = &g_array_index(batch->attachments, RGridAttachment, index);
+
+        gtk_grid_attach(
+            GTK_GRID(batch->grid),
+            current->child,
+            current->left,
+            current->top,
+            current->width,
+            current->height
+        );
+    }
+
+    gtk3_container_thaw(batch->grid, batch->widgets);
+
+    return Qnil;
+}
+
+/**
+ * Frees the native data of a bulk insertion.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RGridBatch of the insertion.
+ * @return [VALUE]
+ */
+static VALUE gtk3_grid_free_batch(VALUE data)
+{
+    RGridBatch *batch = (RGridBatch *) data;
+
+    g_array_free(batch->attachments, TRUE);
+    g_ptr_array_free(batch->widgets, TRUE);
+    g_hash_table_destroy(batch->seen);
+
+    return Qnil;
+}
+
+/* Class methods */
+
+/**
+ * Creates a new grid.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_grid_new(VALUE class)
+{
+    VALUE rb_grid;
+
+    gtk3_ensure_init();
+
+    rb_grid = gtk3_object_wrap(class, gtk_grid_new(), TRUE);
+
+    rb_obj_call_init(rb_grid, 0, NULL);
+
+    return rb_grid;
+}
+
+/* Instance methods */
+
+/**
+ * Attaches a child to the grid at the given position.
+ *
+ * @example
+ *  grid.attach(label, 0, 0)
+ *  grid.attach(entry, 1, 0, 2, 1)
+ *
+ * @since  2026-10-19
+ * @param  [Gtk3::Widget] child The widget to attach.
+ * @param  [Fixnum] left The column of the left side of the child.
+ * @param  [Fixnum] top The row of the top side of the child.
+ * @param  [Fixnum] width The amount of columns the child spans, 1 by default.
+ * @param  [Fixnum] height The amount of rows the child spans, 1 by default.
+ * @raise  [ArgumentError] Raised when the child can't be attached or the
+ *  width or height is smaller than 1.
+ * @return [Gtk3::Grid]
+ */
+static VALUE gtk3_grid_attach(int argc, VALUE *argv, VALUE self)
+{
+    VALUE child;
+    VALUE left;
+    VALUE top;
+    VALUE width;
+    VALUE height;
+    GtkWidget *grid;
+    GtkWidget *widget;
+    int columns;
+    int rows;
+
+    rb_scan_args(argc, argv, "32", &child, &left, &top, &width, &height);
+
+    Data_Get_Struct(self, GtkWidget, grid);
+
+    columns = NIL_P(width) ? 1 : NUM2INT(width);
+    rows    = NIL_P(height) ? 1 : NUM2INT(height);
+
+    gtk3_grid_check_size(columns, rows, -1);
+
+    widget = gtk3_container_check_child(grid, child, -1, NULL);
+
+    gtk_grid_attach(
+        GTK_GRID(grid),
+        widget,
+        NUM2INT(left),
+        NUM2INT(top),
+        columns,
+        rows
+    );
+
+    return self;
+}
+
+/**
+ * Attaches many children using a single native call. Every specification is
+ * an Array of the child and its position: `[child, left, top]` or
+ * `[child, left, top, width, height]`. Notifications are emitted and a
+ * resize is queued once all children have been attached. If any of the
+ * specifications is invalid no children are attached.
+ *
+ * @example
+ *  grid.attach_all([[name_label, 0, 0], [name_entry, 1, 0, 2, 1]])
+ *
+ * @since  2026-10-19
+ * @param  [Array] specs The children and their positions.
+ * @raise  [TypeError] Raised when a specification or child is of the wrong
+ *  type.
+ * @raise  [ArgumentError] Raised when a specification has the wrong size or a
+ *  child can't be attached.
+ * @return [Gtk3::Grid]
+ */
+static VALUE gtk3_grid_attach_all(VALUE self, VALUE specs)
+{
+    RGridBatch batch;
+
+    Check_Type(specs, T_ARRAY);
+
+    Data_Get_Struct(self, GtkWidget, batch.grid);
+
+    batch.specs       = specs;
+    batch.attachments = g_array_sized_new(
+        FALSE,
+        FALSE,
+        sizeof(RGridAttachment),
+        RARRAY_LEN(specs)
+    );
+
+    batch.widgets = g_ptr_array_sized_new(RARRAY_LEN(specs));
+    batch.seen    = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    rb_ensure(
+        gtk3_grid_attach_batch,
+        (VALUE) &batch,
+        gtk3_grid_free_batch,
+        (VALUE) &batch
+    );
+
+    return self;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_grid()
+{
+    gtk3_cGrid = rb_define_class_under(gtk3_mGtk3, "Grid", gtk3_cContainer);
+
+    gtk3_object_register_class(GTK_TYPE_GRID, gtk3_cGrid);
+
+    rb_define_singleton_method(gtk3_cGrid, "new", gtk3_grid_new, 0);
+
+    rb_define_method(gtk3_cGrid, "attach", gtk3_grid_attach, -1);
+    rb_define_method(gtk3_cGrid, "attach_all", gtk3_grid_attach_all, 1);
+}
@@ -0,0 +1,25 @@
+#ifndef GTK3_GRID
+#define GTK3_GRID
+
+#include "gtk3.h"
+
+/**
+ * Structure containing a child and its position, used by
+ * {Gtk3::Grid#attach_all}.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RGridAttachment
+{
+    GtkWidget *child;
+    gint left;
+    gint top;
+    gint width;
+    gint height;
+} RGridAttachment;
+
+extern VALUE gtk3_cGrid;
+
+extern void Init_gtk3_grid();
+
+#endif
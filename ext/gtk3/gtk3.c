@@ -53,7 +53,271 @@ ID gtk3_id_to_sym;
 VALUE gtk3_mGtk3;
 
 /**
- * Starts the main GTK event loop.
+ * Set to TRUE once GTK has been initialized.
+ *
+ * @since 2026-10-19
+ */
+static gboolean gtk3_initialized = FALSE;
+
+/**
+ * Exception raised by a callback called from the main loop. It's raised again
+ * once the main loop returns to Ruby code.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_pending_exception = Qnil;
+
+/**
+ * Initializes GTK using the given command line arguments.
+ *
+ * @since 2026-10-19
+ * @param [int *] argc The amount of arguments, or NULL.
+ * @param [char ***] argv The arguments, or NULL.
+ * @raise [RuntimeError] Raised when GTK couldn't be initialized.
+ */
+static void gtk3_init_check(int *argc, char ***argv)
+{
+    if ( !gtk_init_check(argc, argv) )
+    {
+        rb_raise(
+            rb_eRuntimeError,
+            "GTK could not be initialized, is a display available?"
+        );
+    }
+
+    gtk3_initialized = TRUE;
+}
+
+/**
+ * Removes the arguments handled by GTK and GDK, such as `--display`, from the
+ * given arguments. GTK's own argument parsing already ran when the extension
+ * was required (see Init_gtk3()), thus gtk_init() no longer looks at any
+ * arguments. The same option group is used here instead.
+ *
+ * @since 2026-10-19
+ * @param [int *] argc The amount of arguments.
+ * @param [char ***] argv The arguments.
+ * @raise [Gtk3::Error] Raised when an argument is invalid.
+ */
+static void gtk3_parse_args(int *argc, char ***argv)
+{
+    gboolean parsed;
+    GError *error           = NULL;
+    GOptionContext *context = g_option_context_new(NULL);
+
+    g_option_context_set_ignore_unknown_options(context, TRUE);
+    g_option_context_set_help_enabled(context, FALSE);
+    g_option_context_set_main_group(context, gtk_get_option_group(FALSE));
+
+    parsed = g_option_context_parse(context, argc, argv, &error);
+
+    g_option_context_free(context);
+
+    if ( !parsed )
+    {
+        gtk3_error_raise(error);
+    }
+}
+
+/**
+ * Initializes GTK unless this has already been done. GTK is initialized
+ * lazily so that requiring the extension doesn't open a display connection,
+ * allowing code that only uses the accelerator helpers to run without a
+ * display.
+ *
+ * @since 2026-10-19
+ * @raise [RuntimeError] Raised when GTK couldn't be initialized.
+ */
+void gtk3_ensure_init()
+{
+    if ( !gtk3_initialized )
+    {
+        gtk3_init_check(NULL, NULL);
+    }
+}
+
+/**
+ * Calls a function from a callback of the main loop (such as an idle source)
+ * or from a signal emission. Exceptions can't be raised through GLib code,
+ * instead the exception is stored and the main loop is stopped. The exception
+ * is raised again once {Gtk3.main} or {Gtk3.main_iteration} returns. Only the
+ * first exception is kept if several callbacks raise.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE (*)(VALUE)] function The function to call.
+ * @param  [VALUE] data The argument to pass to the function.
+ * @return [VALUE] The return value of the function, or Qundef if it raised.
+ */
+VALUE gtk3_protect(VALUE (*function)(VALUE), VALUE data)
+{
+    int state = 0;
+    VALUE result;
+
+    result = rb_protect(function, data, &state);
+
+    if ( !state )
+    {
+        return result;
+    }
+
+    if ( NIL_P(gtk3_pending_exception) )
+    {
+        gtk3_pending_exception = rb_errinfo();
+    }
+
+    rb_set_errinfo(Qnil);
+
+    if ( gtk_main_level() > 0 )
+    {
+        gtk_main_quit();
+    }
+
+    return Qundef;
+}
+
+/**
+ * Calls the callable with the given argument. Used by gtk3_call_protected().
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Pointer to an array of the callable and the argument.
+ * @return [VALUE]
+ */
+static VALUE gtk3_call_callable(VALUE data)
+{
+    VALUE *args = (VALUE *) data;
+
+    return rb_funcall(args[0], gtk3_id_call, 1, args[1]);
+}
+
+/**
+ * Calls a callable using gtk3_protect().
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] callable The object to call.
+ * @param  [VALUE] argument The argument to pass to the callable.
+ * @return [VALUE] The return value of the callable, or nil if it raised.
+ */
+VALUE gtk3_call_protected(VALUE callable, VALUE argument)
+{
+    VALUE result;
+    VALUE args[2];
+
+    args[0] = callable;
+    args[1] = argument;
+
+    result = gtk3_protect(gtk3_call_callable, (VALUE) args);
+
+    return result == Qundef ? Qnil : result;
+}
+
+/**
+ * Raises the exception stored by gtk3_protect(), if any. Methods that emit
+ * signals directly use this to raise exceptions of the signal handlers once
+ * the emission has finished.
+ *
+ * @since 2026-10-19
+ */
+void gtk3_raise_pending()
+{
+    VALUE exception = gtk3_pending_exception;
+
+    if ( NIL_P(exception) )
+    {
+        return;
+    }
+
+    gtk3_pending_exception = Qnil;
+
+    rb_exc_raise(exception);
+}
+
+/**
+ * Initializes GTK using the given command line arguments and returns the
+ * arguments that weren't handled by GTK. GTK is initialized automatically
+ * the first time it's needed, this method only has to be used to pass
+ * arguments such as `--display` to GTK. The arguments are returned as is if
+ * GTK has already been initialized.
+ *
+ * @example
+ *  ARGV.replace(Gtk3.init(ARGV))
+ *
+ * @since  2026-10-19
+ * @param  [Array] arguments The command line arguments, empty by default.
+ * @raise  [RuntimeError] Raised when GTK couldn't be initialized.
+ * @raise  [Gtk3::Error] Raised when an argument is invalid.
+ * @return [Array]
+ */
+static VALUE gtk3_init(int argc, VALUE *argv, VALUE self)
+{
+    VALUE arguments;
+    VALUE program;
+    VALUE argument;
+    VALUE remaining;
+    long index;
+    int gtk_argc;
+    char **gtk_argv;
+
+    rb_scan_args(argc, argv, "01", &arguments);
+
+    if ( NIL_P(arguments) )
+    {
+        arguments = rb_ary_new();
+    }
+
+    Check_Type(arguments, T_ARRAY);
+
+    if ( gtk3_initialized )
+    {
+        return rb_ary_dup(arguments);
+    }
+
+    program  = rb_gv_get("$PROGRAM_NAME");
+    gtk_argc = (int) RARRAY_LEN(arguments) + 1;
+    gtk_argv = ALLOCA_N(char *, gtk_argc + 1);
+
+    gtk_argv[0]        = StringValueCStr(program);
+    gtk_argv[gtk_argc] = NULL;
+
+    for ( index = 0; index < RARRAY_LEN(arguments); index++ )
+    {
+        argument = rb_ary_entry(arguments, index);
+
+        Check_Type(argument, T_STRING);
+
+        gtk_argv[index + 1] = StringValueCStr(argument);
+    }
+
+    /* GTK removes the arguments it handled by moving the pointers around. */
+    gtk3_parse_args(&gtk_argc, &gtk_argv);
+    gtk3_init_check(NULL, NULL);
+
+    remaining = rb_ary_new2(gtk_argc - 1);
+
+    for ( index = 1; index < gtk_argc; index++ )
+    {
+        rb_ary_push(remaining, rb_external_str_new_cstr(gtk_argv[index]));
+    }
+
+    return remaining;
+}
+
+/**
+ * Returns `true` if GTK has been initialized.
+ *
+ * @since  2026-10-19
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_is_initialized(VALUE self)
+{
+    return gtk3_initialized ? Qtrue : Qfalse;
+}
+
+/**
+ * Starts the main GTK event loop. Exceptions raised by callbacks that are
+ * called from the main loop (e.g. signal handlers or the block of
+ * {Gtk3::AccelMap.save\_async}) stop the loop and are raised by this method.
+ * Exceptions raised by signal handlers outside of the main loop are raised
+ * before the loop is started.
  *
  * @example
  *  Gtk3.main
@@ -62,8 +326,14 @@ VALUE gtk3_mGtk3;
  */
 static VALUE gtk3_main(VALUE self)
 {
+    gtk3_ensure_init();
+
+    gtk3_raise_pending();
+
     gtk_main();
 
+    gtk3_raise_pending();
+
     return Qnil;
 }
 
@@ -77,20 +347,29 @@ static VALUE gtk3_main(VALUE self)
  */
 static VALUE gtk3_main_quit(VALUE self)
 {
+    gtk3_ensure_init();
+
     gtk_main_quit();
 
     return Qnil;
 }
 
 /**
- * Runs a single iteration of the GTK event loop.
+ * Runs a single iteration of the GTK event loop. Exceptions are raised the
+ * same way as {Gtk3.main} does.
  *
  * @since 2012-06-05
  */
 static VALUE gtk3_main_iteration(VALUE self)
 {
+    gtk3_ensure_init();
+
+    gtk3_raise_pending();
+
     gtk_main_iteration();
 
+    gtk3_raise_pending();
+
     return Qnil;
 }
 
@@ -102,9 +381,75 @@ static VALUE gtk3_main_iteration(VALUE self)
  */
 static VALUE gtk3_events_pending(VALUE self)
 {
+    gtk3_ensure_init();
+
     return gtk3_gboolean_to_rboolean(gtk_events_pending());
 }
 
+/**
+ * Creates a new object of the given type and sets the given properties in a
+ * single call. The type can be specified as a class such as {Gtk3::Window} or
+ * as the name of a GType such as "GtkWindow". Type names are resolved once and
+ * cached afterwards.
+ *
+ * Unlike constructors such as {Gtk3::Window.new} this method does not call
+ * `#initialize` on the returned object.
+ *
+ * @example
+ *  window = Gtk3.create(:GtkWindow, :title => 'Example', :modal => true)
+ *
+ * @since  2026-10-19
+ * @param  [Class|String|Symbol] type The type of the object to create.
+ * @param  [Hash] properties The properties to set.
+ * @raise  [ArgumentError] Raised when the type can't be instantiated.
+ * @return [Object]
+ */
+static VALUE gtk3_create(int argc, VALUE *argv, VALUE self)
+{
+    VALUE type_name;
+    VALUE properties;
+    VALUE klass;
+    GType type;
+    GObject *object;
+
+    rb_scan_args(argc, argv, "11", &type_name, &properties);
+
+    if ( NIL_P(properties) )
+    {
+        properties = rb_hash_new();
+    }
+
+    type = gtk3_object_lookup_gtype(type_name);
+
+    if ( !G_TYPE_IS_OBJECT(type) || G_TYPE_IS_ABSTRACT(type) )
+    {
+        rb_raise(
+            rb_eArgError,
+            "%s can not be instantiated",
+            g_type_name(type)
+        );
+    }
+
+    if ( TYPE(type_name) == T_CLASS )
+    {
+        klass = type_name;
+    }
+    else
+    {
+        klass = gtk3_object_class(type);
+    }
+
+    if ( g_type_is_a(type, GTK_TYPE_WIDGET) )
+    {
+        gtk3_ensure_init();
+    }
+
+    object = gtk3_property_new_object(type, properties);
+
+    /* Toplevel windows are owned by GTK until they're destroyed. */
+    return gtk3_object_wrap(klass, object, !GTK_IS_WINDOW(object));
+}
+
 /**
  * Sets up all the provides classes and modules.
  *
@@ -112,10 +457,17 @@ static VALUE gtk3_events_pending(VALUE self)
  */
 void Init_gtk3()
 {
-    gtk_init(NULL, NULL);
-
     gtk3_mGtk3 = rb_define_module("Gtk3");
 
+    rb_define_singleton_method(gtk3_mGtk3, "init", gtk3_init, -1);
+
+    rb_define_singleton_method(
+        gtk3_mGtk3,
+        "initialized?",
+        gtk3_is_initialized,
+        0
+    );
+
     rb_define_singleton_method(gtk3_mGtk3, "main", gtk3_main, 0);
     rb_define_singleton_method(gtk3_mGtk3, "main_quit", gtk3_main_quit, 0);
 
@@ -133,6 +485,10 @@ void Init_gtk3()
         0
     );
 
+    rb_define_singleton_method(gtk3_mGtk3, "create", gtk3_create, -1);
+
+    rb_global_variable(&gtk3_pending_exception);
+
     /* IDs for various symbols that are re-used throughout the codebase. */
     gtk3_id_new    = rb_intern("new");
     gtk3_id_call   = rb_intern("call");
@@ -141,16 +497,46 @@ void Init_gtk3()
     gtk3_id_upcase = rb_intern("upcase");
     gtk3_id_to_sym = rb_intern("to_sym");
 
+    /*
+    GTK only creates the accelerator map while parsing its arguments. This is
+    done right away as the accelerator map is used while setting up the
+    classes below, it doesn't open a display.
+    */
+    gtk_parse_args(NULL, NULL);
 
     /* Set up all the other required classes and modules. */
+    Init_gtk3_type();
+    Init_gtk3_property();
+    Init_gtk3_object();
+    Init_gtk3_boxed();
+    Init_gtk3_error();
+    Init_gtk3_bytes();
+    Init_gtk3_utf8();
+    Init_gtk3_resource();
     Init_gtk3_lookup_constant();
     Init_gtk3_accel_lookup();
+    Init_gtk3_accel_cache();
     Init_gtk3_accel_flag();
     Init_gtk3_accel_key();
     Init_gtk3_accel_map();
+    Init_gtk3_accel_journal();
+    Init_gtk3_accel_search();
+    Init_gtk3_accel_notify();
     Init_gtk3_accel_group();
+    Init_gtk3_accel_table();
+    Init_gtk3_accel_index();
     Init_gtk3_accel_group_entry();
     Init_gtk3_modifier_type();
     Init_gtk3_widget();
+    Init_gtk3_widget_query();
+    Init_gtk3_widget_style();
+    Init_gtk3_container();
+    Init_gtk3_box();
+    Init_gtk3_grid();
     Init_gtk3_window();
+    Init_gtk3_key_sequence();
+    Init_gtk3_builder();
+    Init_gtk3_pixbuf();
+    Init_gtk3_css_provider();
+    Init_gtk3_introspection();
 }
@@ -2,19 +2,43 @@
 #define GTK3_NATIVE
 
 #include <ruby.h>
+#include <ruby/encoding.h>
 #include <gtk/gtk.h>
 #include "closure.h"
 #include "type.h"
+#include "property.h"
+#include "object.h"
+#include "boxed.h"
+#include "error.h"
+#include "bytes.h"
+#include "utf8.h"
+#include "resource.h"
 #include "lookup_constant.h"
 #include "accel_lookup.h"
+#include "accel_cache.h"
 #include "accel_flag.h"
 #include "accel_map.h"
+#include "accel_journal.h"
+#include "accel_search.h"
+#include "accel_notify.h"
 #include "accel_key.h"
 #include "accel_group.h"
+#include "accel_table.h"
+#include "accel_index.h"
 #include "accel_group_entry.h"
 #include "modifier_type.h"
 #include "widget.h"
+#include "widget_query.h"
+#include "widget_style.h"
+#include "container.h"
+#include "box.h"
+#include "grid.h"
 #include "window.h"
+#include "key_sequence.h"
+#include "builder.h"
+#include "pixbuf.h"
+#include "css_provider.h"
+#include "introspection.h"
 
 extern ID gtk3_id_new;
 extern ID gtk3_id_call;
@@ -25,6 +49,11 @@ extern ID gtk3_id_to_sym;
 
 extern VALUE gtk3_mGtk3;
 
+extern void gtk3_ensure_init();
+extern VALUE gtk3_protect(VALUE (*function)(VALUE), VALUE data);
+extern VALUE gtk3_call_protected(VALUE callable, VALUE argument);
+extern void gtk3_raise_pending();
+
 extern void Init_gtk3();
 
 #endif
@@ -0,0 +1,1263 @@
+#include "introspection.h"
+
+#ifdef HAVE_GI
+
+/**
+ * The namespace of the typelib used for defining classes and methods.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_INTROSPECTION_NAMESPACE "Gtk"
+
+/**
+ * Structure used for a single call of an introspected function.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RIntrospectionCall
+{
+    RIntrospectionFunction *function;
+    VALUE self;
+    VALUE *argv;
+    GValue *values;
+    GValue result;
+    GIArgument *arguments;
+    gpointer *ffi_args;
+    GError *error;
+} RIntrospectionCall;
+
+/**
+ * Set to TRUE once loading the typelib has been attempted.
+ *
+ * @since 2026-10-19
+ */
+static gboolean gtk3_introspection_attempted = FALSE;
+
+/**
+ * Set to TRUE if the typelib was loaded.
+ *
+ * @since 2026-10-19
+ */
+static gboolean gtk3_introspection_loaded = FALSE;
+
+/**
+ * Hash table that maps GTypes to hash tables of their functions. The inner
+ * tables map method names (as IDs) to RIntrospectionFunction structures, or
+ * NULL for names that don't refer to a supported function.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_introspection_functions;
+
+/**
+ * Set of GTypes for which no class can be defined.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_introspection_unresolved;
+
+/* Helper methods */
+
+/**
+ * Loads the typelib the first time it's needed. Failing to load the typelib
+ * isn't an error, it merely disables the introspected classes and methods.
+ *
+ * @since  2026-10-19
+ * @return [gboolean]
+ */
+static gboolean gtk3_introspection_require()
+{
+    GError *error = NULL;
+
+    if ( gtk3_introspection_attempted )
+    {
+        return gtk3_introspection_loaded;
+    }
+
+    gtk3_introspection_attempted = TRUE;
+    gtk3_introspection_loaded    = g_irepository_require(
+        NULL,
+        GTK3_INTROSPECTION_NAMESPACE,
+        "3.0",
+        0,
+        &error
+    ) != NULL;
+
+    if ( error )
+    {
+        g_error_free(error);
+    }
+
+    return gtk3_introspection_loaded;
+}
+
+/**
+ * Determines the GType and type tag of an argument or return value. Returns
+ * FALSE if values of the type can't be converted.
+ *
+ * @since  2026-10-19
+ * @param  [RIntrospectionArg *] arg The argument to set up.
+ * @param  [GITypeInfo *] type_info The type of the argument.
+ * @return [gboolean]
+ */
+static gboolean gtk3_introspection_arg_init(
+    RIntrospectionArg *arg,
+    GITypeInfo *type_info
+)
+{
+    GIBaseInfo *interface;
+    GIInfoType info_type;
+
+    arg->tag  = g_type_info_get_tag(type_info);
+    arg->type = G_TYPE_INVALID;
+
+    switch ( arg->tag )
+    {
+        case GI_TYPE_TAG_BOOLEAN:
+            arg->type = G_TYPE_BOOLEAN;
+            break;
+
+        case GI_TYPE_TAG_INT8:
+            arg->type = G_TYPE_CHAR;
+            break;
+
+        case GI_TYPE_TAG_UINT8:
+            arg->type = G_TYPE_UCHAR;
+            break;
+
+        case GI_TYPE_TAG_INT16:
+        case GI_TYPE_TAG_INT32:
+            arg->type = G_TYPE_INT;
+            break;
+
+        case GI_TYPE_TAG_UINT16:
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_UNICHAR:
+            arg->type = G_TYPE_UINT;
+            break;
+
+        case GI_TYPE_TAG_INT64:
+            arg->type = G_TYPE_INT64;
+            break;
+
+        case GI_TYPE_TAG_UINT64:
+            arg->type = G_TYPE_UINT64;
+            break;
+
+        case GI_TYPE_TAG_FLOAT:
+            arg->type = G_TYPE_FLOAT;
+            break;
+
+        case GI_TYPE_TAG_DOUBLE:
+            arg->type = G_TYPE_DOUBLE;
+            break;
+
+        case GI_TYPE_TAG_UTF8:
+        case GI_TYPE_TAG_FILENAME:
+            arg->type = G_TYPE_STRING;
+            break;
+
+        case GI_TYPE_TAG_INTERFACE:
+            interface = g_type_info_get_interface(type_info);
+            info_type = g_base_info_get_type(interface);
+
+            /* Enums and flags are passed by value, everything else by
+            reference. */
+            if ( info_type == GI_INFO_TYPE_ENUM
+            || info_type == GI_INFO_TYPE_FLAGS
+            || ((info_type == GI_INFO_TYPE_OBJECT
+            || info_type == GI_INFO_TYPE_STRUCT
+            || info_type == GI_INFO_TYPE_UNION
+            || info_type == GI_INFO_TYPE_BOXED)
+            && g_type_info_is_pointer(type_info)) )
+            {
+                arg->type = g_registered_type_info_get_g_type(
+                    (GIRegisteredTypeInfo *) interface
+                );
+            }
+
+            g_base_info_unref(interface);
+            break;
+
+        default:
+            break;
+    }
+
+    if ( arg->type == G_TYPE_INVALID || arg->type == G_TYPE_NONE )
+    {
+        return FALSE;
+    }
+
+    return gtk3_value_converter(arg->type) != NULL;
+}
+
+/**
+ * Releases a function that turned out to be unsupported.
+ *
+ * @since 2026-10-19
+ * @param [RIntrospectionFunction *] function The function to release.
+ */
+static void gtk3_introspection_function_free(RIntrospectionFunction *function)
+{
+    g_base_info_unref(function->result_info);
+    g_free(function->args);
+    g_free(function);
+}
+
+/**
+ * Prepares a function for being called from Ruby. Only functions that take
+ * input arguments of types that can be converted are supported, NULL is
+ * returned for all other functions.
+ *
+ * @since  2026-10-19
+ * @param  [GIFunctionInfo *] info The function to prepare.
+ * @param  [GType] instance_type The type that declares the function.
+ * @return [RIntrospectionFunction *]
+ */
+static RIntrospectionFunction *gtk3_introspection_function_new(
+    GIFunctionInfo *info,
+    GType instance_type
+)
+{
+    gint index;
+    GIArgInfo *arg_info;
+    GITypeInfo *type_info;
+    RIntrospectionFunction *function;
+    GError *error             = NULL;
+    gboolean supported        = TRUE;
+    GIFunctionInfoFlags flags = g_function_info_get_flags(info);
+
+    function = g_new0(RIntrospectionFunction, 1);
+
+    function->n_args      = g_callable_info_get_n_args(info);
+    function->args        = g_new0(RIntrospectionArg, function->n_args);
+    function->constructor = (flags & GI_FUNCTION_IS_CONSTRUCTOR) != 0;
+    function->throws      = (flags & GI_FUNCTION_THROWS) != 0;
+    function->result_info = g_callable_info_get_return_type(info);
+
+    if ( flags & GI_FUNCTION_IS_METHOD )
+    {
+        function->instance_type = instance_type;
+    }
+
+    for ( index = 0; supported && index < function->n_args; index++ )
+    {
+        arg_info  = g_callable_info_get_arg(info, index);
+        type_info = g_arg_info_get_type(arg_info);
+
+        function->args[index].transfer = g_arg_info_get_ownership_transfer(
+            arg_info
+        );
+
+        supported = g_arg_info_get_direction(arg_info) == GI_DIRECTION_IN
+            && function->args[index].transfer == GI_TRANSFER_NOTHING
+            && gtk3_introspection_arg_init(&function->args[index], type_info);
+
+        g_base_info_unref(type_info);
+        g_base_info_unref(arg_info);
+    }
+
+    function->result.transfer = g_callable_info_get_caller_owns(info);
+
+    if ( g_type_info_get_tag(function->result_info) == GI_TYPE_TAG_VOID
+    && !g_type_info_is_pointer(function->result_info) )
+    {
+        function->result.type = G_TYPE_NONE;
+    }
+    else if ( supported )
+    {
+        supported = gtk3_introspection_arg_init(
+            &function->result,
+            function->result_info
+        );
+    }
+
+    if ( supported
+    && !g_function_info_prep_invoker(info, &function->invoker, &error) )
+    {
+        g_error_free(error);
+
+        supported = FALSE;
+    }
+
+    if ( !supported )
+    {
+        gtk3_introspection_function_free(function);
+
+        return NULL;
+    }
+
+    function->info = g_base_info_ref(info);
+
+    return function;
+}
+
+/**
+ * Finds the function with the given name in the typelib entry of a type.
+ * Methods of interfaces implemented by the type are included.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type to search.
+ * @param  [ID] name The name of the function.
+ * @return [RIntrospectionFunction *]
+ */
+static RIntrospectionFunction *gtk3_introspection_function_find(
+    GType type,
+    ID name
+)
+{
+    GIBaseInfo *info;
+    GIBaseInfo *implementor          = NULL;
+    GIFunctionInfo *found            = NULL;
+    RIntrospectionFunction *function = NULL;
+    GType instance_type              = type;
+
+    info = g_irepository_find_by_gtype(NULL, type);
+
+    if ( info == NULL )
+    {
+        return NULL;
+    }
+
+    if ( g_base_info_get_type(info) == GI_INFO_TYPE_OBJECT )
+    {
+        found = g_object_info_find_method_using_interfaces(
+            (GIObjectInfo *) info,
+            rb_id2name(name),
+            (GIObjectInfo **) &implementor
+        );
+    }
+
+    if ( implementor )
+    {
+        instance_type = g_registered_type_info_get_g_type(
+            (GIRegisteredTypeInfo *) implementor
+        );
+
+        g_base_info_unref(implementor);
+    }
+
+    if ( found )
+    {
+        function = gtk3_introspection_function_new(found, instance_type);
+
+        g_base_info_unref(found);
+    }
+
+    g_base_info_unref(info);
+
+    return function;
+}
+
+/**
+ * Returns the function with the given name declared by a type, preparing it
+ * the first time it's requested.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type that declares the function.
+ * @param  [ID] name The name of the function.
+ * @return [RIntrospectionFunction *]
+ */
+static RIntrospectionFunction *gtk3_introspection_cached(GType type, ID name)
+{
+    GHashTable *functions;
+    gpointer function = NULL;
+
+    functions = g_hash_table_lookup(
+        gtk3_introspection_functions,
+        GSIZE_TO_POINTER(type)
+    );
+
+    if ( functions == NULL )
+    {
+        functions = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+        g_hash_table_insert(
+            gtk3_introspection_functions,
+            GSIZE_TO_POINTER(type),
+            functions
+        );
+    }
+
+    if ( !g_hash_table_lookup_extended(
+        functions,
+        GSIZE_TO_POINTER(name),
+        NULL,
+        &function
+    ) )
+    {
+        function = gtk3_introspection_function_find(type, name);
+
+        g_hash_table_insert(functions, GSIZE_TO_POINTER(name), function);
+    }
+
+    return (RIntrospectionFunction *) function;
+}
+
+/**
+ * Finds a function in a type or any of its parent types. Only methods are
+ * returned when `instance` is TRUE, only other functions otherwise.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type to start searching at.
+ * @param  [ID] name The name of the function.
+ * @param  [gboolean] instance Whether to look for a method.
+ * @param  [GType *] declaring Set to the type the function was found in, if
+ *  not NULL.
+ * @return [RIntrospectionFunction *]
+ */
+static RIntrospectionFunction *gtk3_introspection_lookup(
+    GType type,
+    ID name,
+    gboolean instance,
+    GType *declaring
+)
+{
+    GType current;
+    RIntrospectionFunction *function;
+
+    if ( !gtk3_introspection_require() )
+    {
+        return NULL;
+    }
+
+    for ( current = type; current != 0; current = g_type_parent(current) )
+    {
+        function = gtk3_introspection_cached(current, name);
+
+        if ( function && (function->instance_type != 0) == instance )
+        {
+            if ( declaring )
+            {
+                *declaring = current;
+            }
+
+            return function;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * Stores a return value in a GValue, taking over ownership of the value if
+ * it's transferred to the caller.
+ *
+ * @since 2026-10-19
+ * @param [RIntrospectionArg *] arg The return value description.
+ * @param [GIArgument *] argument The return value.
+ * @param [GValue *] value The initialized GValue to store the value in.
+ */
+static void gtk3_introspection_set_result(
+    RIntrospectionArg *arg,
+    GIArgument *argument,
+    GValue *value
+)
+{
+    gboolean owned = arg->transfer != GI_TRANSFER_NOTHING;
+
+    switch ( arg->tag )
+    {
+        case GI_TYPE_TAG_BOOLEAN:
+            g_value_set_boolean(value, argument->v_boolean);
+            break;
+
+        case GI_TYPE_TAG_INT8:
+            g_value_set_schar(value, argument->v_int8);
+            break;
+
+        case GI_TYPE_TAG_UINT8:
+            g_value_set_uchar(value, argument->v_uint8);
+            break;
+
+        case GI_TYPE_TAG_INT16:
+            g_value_set_int(value, argument->v_int16);
+            break;
+
+        case GI_TYPE_TAG_INT32:
+            g_value_set_int(value, argument->v_int32);
+            break;
+
+        case GI_TYPE_TAG_UINT16:
+            g_value_set_uint(value, argument->v_uint16);
+            break;
+
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_UNICHAR:
+            g_value_set_uint(value, argument->v_uint32);
+            break;
+
+        case GI_TYPE_TAG_INT64:
+            g_value_set_int64(value, argument->v_int64);
+            break;
+
+        case GI_TYPE_TAG_UINT64:
+            g_value_set_uint64(value, argument->v_uint64);
+            break;
+
+        case GI_TYPE_TAG_FLOAT:
+            g_value_set_float(value, argument->v_float);
+            break;
+
+        case GI_TYPE_TAG_DOUBLE:
+            g_value_set_double(value, argument->v_double);
+            break;
+
+        case GI_TYPE_TAG_UTF8:
+        case GI_TYPE_TAG_FILENAME:
+            if ( owned )
+            {
+                g_value_take_string(value, argument->v_string);
+            }
+            else
+            {
+                g_value_set_string(value, argument->v_string);
+            }
+
+            break;
+
+        default:
+            switch ( G_TYPE_FUNDAMENTAL(arg->type) )
+            {
+                case G_TYPE_ENUM:
+                    g_value_set_enum(value, argument->v_int);
+                    break;
+
+                case G_TYPE_FLAGS:
+                    g_value_set_flags(value, argument->v_uint);
+                    break;
+
+                case G_TYPE_OBJECT:
+                    /* Owned floating references would otherwise be lost
+                    when the Ruby object sinks them. */
+                    if ( owned && g_object_is_floating(argument->v_pointer) )
+                    {
+                        g_object_ref_sink(argument->v_pointer);
+                    }
+
+                    if ( owned )
+                    {
+                        g_value_take_object(value, argument->v_pointer);
+                    }
+                    else
+                    {
+                        g_value_set_object(value, argument->v_pointer);
+                    }
+
+                    break;
+
+                default:
+                    if ( owned )
+                    {
+                        g_value_take_boxed(value, argument->v_pointer);
+                    }
+                    else
+                    {
+                        g_value_set_boxed(value, argument->v_pointer);
+                    }
+
+                    break;
+            }
+
+            break;
+    }
+}
+
+/**
+ * Stores a converted Ruby argument in a GIArgument. The GValue must be kept
+ * around until the function has been called.
+ *
+ * @since 2026-10-19
+ * @param [RIntrospectionArg *] arg The argument description.
+ * @param [GValue *] value The converted argument.
+ * @param [GIArgument *] argument The GIArgument to store the argument in.
+ */
+static void gtk3_introspection_set_argument(
+    RIntrospectionArg *arg,
+    GValue *value,
+    GIArgument *argument
+)
+{
+    switch ( arg->tag )
+    {
+        case GI_TYPE_TAG_BOOLEAN:
+            argument->v_boolean = g_value_get_boolean(value);
+            break;
+
+        case GI_TYPE_TAG_INT8:
+            argument->v_int8 = g_value_get_schar(value);
+            break;
+
+        case GI_TYPE_TAG_UINT8:
+            argument->v_uint8 = g_value_get_uchar(value);
+            break;
+
+        case GI_TYPE_TAG_INT16:
+            argument->v_int16 = g_value_get_int(value);
+            break;
+
+        case GI_TYPE_TAG_INT32:
+            argument->v_int32 = g_value_get_int(value);
+            break;
+
+        case GI_TYPE_TAG_UINT16:
+            argument->v_uint16 = g_value_get_uint(value);
+            break;
+
+        case GI_TYPE_TAG_UINT32:
+        case GI_TYPE_TAG_UNICHAR:
+            argument->v_uint32 = g_value_get_uint(value);
+            break;
+
+        case GI_TYPE_TAG_INT64:
+            argument->v_int64 = g_value_get_int64(value);
+            break;
+
+        case GI_TYPE_TAG_UINT64:
+            argument->v_uint64 = g_value_get_uint64(value);
+            break;
+
+        case GI_TYPE_TAG_FLOAT:
+            argument->v_float = g_value_get_float(value);
+            break;
+
+        case GI_TYPE_TAG_DOUBLE:
+            argument->v_double = g_value_get_double(value);
+            break;
+
+        case GI_TYPE_TAG_UTF8:
+        case GI_TYPE_TAG_FILENAME:
+            argument->v_pointer = (gpointer) g_value_get_string(value);
+            break;
+
+        default:
+            switch ( G_TYPE_FUNDAMENTAL(arg->type) )
+            {
+                case G_TYPE_ENUM:
+                    argument->v_int = g_value_get_enum(value);
+                    break;
+
+                case G_TYPE_FLAGS:
+                    argument->v_uint = g_value_get_flags(value);
+                    break;
+
+                case G_TYPE_OBJECT:
+                    argument->v_pointer = g_value_get_object(value);
+                    break;
+
+                default:
+                    argument->v_pointer = g_value_get_boxed(value);
+                    break;
+            }
+
+            break;
+    }
+}
+
+/**
+ * Converts the arguments of a call and calls the function using its
+ * prepared invoker.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RIntrospectionCall of the call.
+ * @return [VALUE]
+ */
+static VALUE gtk3_introspection_invoke(VALUE data)
+{
+    gint index;
+    gint offset = 0;
+    GError *error;
+    GIArgument result;
+    GIFFIReturnValue ffi_result;
+    RIntrospectionCall *call         = (RIntrospectionCall *) data;
+    RIntrospectionFunction *function = call->function;
+
+    if ( function->instance_type != 0 )
+    {
+        call->arguments[0].v_pointer = gtk3_object_unwrap(
+            call->self,
+            function->instance_type
+        );
+
+        offset = 1;
+    }
+
+    for ( index = 0; index < function->n_args; index++ )
+    {
+        g_value_init(&call->values[index], function->args[index].type);
+
+        gtk3_rbvalue_to_gvalue(call->argv[index], &call->values[index]);
+
+        gtk3_introspection_set_argument(
+            &function->args[index],
+            &call->values[index],
+            &call->arguments[index + offset]
+        );
+    }
+
+    if ( function->throws )
+    {
+        call->arguments[function->n_args + offset].v_pointer = &call->error;
+    }
+
+    ffi_call(
+        &function->invoker.cif,
+        FFI_FN(function->invoker.native_address),
+        &ffi_result,
+        call->ffi_args
+    );
+
+    if ( call->error )
+    {
+        error       = call->error;
+        call->error = NULL;
+
+        gtk3_error_raise(error);
+    }
+
+    if ( function->result.type == G_TYPE_NONE )
+    {
+        return Qnil;
+    }
+
+    gi_type_info_extract_ffi_return_value(
+        function->result_info,
+        &ffi_result,
+        &result
+    );
+
+    if ( g_type_info_is_pointer(function->result_info)
+    && result.v_pointer == NULL )
+    {
+        return Qnil;
+    }
+
+    g_value_init(&call->result, function->result.type);
+
+    gtk3_introspection_set_result(&function->result, &result, &call->result);
+
+    return gtk3_gvalue_to_rbvalue(&call->result);
+}
+
+/**
+ * Releases the values of a call.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RIntrospectionCall of the call.
+ * @return [VALUE]
+ */
+static VALUE gtk3_introspection_release(VALUE data)
+{
+    gint index;
+    RIntrospectionCall *call = (RIntrospectionCall *) data;
+
+    for ( index = 0; index < call->function->n_args; index++ )
+    {
+        if ( G_IS_VALUE(&call->values[index]) )
+        {
+            g_value_unset(&call->values[index]);
+        }
+    }
+
+    if ( G_IS_VALUE(&call->result) )
+    {
+        g_value_unset(&call->result);
+    }
+
+    if ( call->error )
+    {
+        g_error_free(call->error);
+    }
+
+    return Qnil;
+}
+
+/**
+ * Calls an introspected function with the given Ruby arguments. Constructors
+ * call `#initialize` on the returned object.
+ *
+ * @since  2026-10-19
+ * @param  [RIntrospectionFunction *] function The function to call.
+ * @param  [int] argc The amount of arguments.
+ * @param  [VALUE *] argv The arguments.
+ * @param  [VALUE] self The receiver, used as the instance of methods.
+ * @raise  [ArgumentError] Raised when the amount of arguments is incorrect.
+ * @return [VALUE]
+ */
+static VALUE gtk3_introspection_call(
+    RIntrospectionFunction *function,
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    gint index;
+    gint n_ffi_args;
+    VALUE rb_result;
+    RIntrospectionCall call;
+
+    if ( argc != function->n_args )
+    {
+        rb_raise(
+            rb_eArgError,
+            "wrong number of arguments(%i for %i)",
+            argc,
+            function->n_args
+        );
+    }
+
+    n_ffi_args = function->n_args
+        + (function->instance_type != 0 ? 1 : 0)
+        + (function->throws ? 1 : 0);
+
+    call.function  = function;
+    call.self      = self;
+    call.argv      = argv;
+    call.error     = NULL;
+    call.values    = ALLOCA_N(GValue, function->n_args);
+    call.arguments = ALLOCA_N(GIArgument, n_ffi_args);
+    call.ffi_args  = ALLOCA_N(gpointer, n_ffi_args);
+
+    memset(call.values, 0, sizeof(GValue) * function->n_args);
+    memset(&call.result, 0, sizeof(GValue));
+
+    for ( index = 0; index < n_ffi_args; index++ )
+    {
+        call.ffi_args[index] = &call.arguments[index];
+    }
+
+    rb_result = rb_ensure(
+        gtk3_introspection_invoke,
+        (VALUE) &call,
+        gtk3_introspection_release,
+        (VALUE) &call
+    );
+
+    if ( function->constructor && !NIL_P(rb_result) )
+    {
+        rb_obj_call_init(rb_result, 0, NULL);
+    }
+
+    return rb_result;
+}
+
+/**
+ * Returns the GType of a class or its closest registered parent class.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] klass The class.
+ * @return [GType]
+ */
+static GType gtk3_introspection_class_gtype(VALUE klass)
+{
+    if ( TYPE(klass) != T_CLASS )
+    {
+        return 0;
+    }
+
+    return gtk3_object_gtype(klass);
+}
+
+/* Trampolines */
+
+/**
+ * Calls an introspected method that was defined by
+ * {Gtk3::Object#method_missing}. The function is looked up using the name of
+ * the current method.
+ *
+ * @since  2026-10-19
+ * @param  [Array] args The arguments of the method.
+ * @return [Object]
+ */
+static VALUE gtk3_introspection_method(int argc, VALUE *argv, VALUE self)
+{
+    GObject *object;
+    RIntrospectionFunction *function;
+    ID name = rb_frame_this_func();
+
+    Data_Get_Struct(self, GObject, object);
+
+    function = gtk3_introspection_lookup(
+        G_OBJECT_TYPE(object),
+        name,
+        TRUE,
+        NULL
+    );
+
+    if ( function == NULL )
+    {
+        rb_raise(
+            rb_eNoMethodError,
+            "undefined method `%s' for %s",
+            rb_id2name(name),
+            G_OBJECT_TYPE_NAME(object)
+        );
+    }
+
+    return gtk3_introspection_call(function, argc, argv, self);
+}
+
+/**
+ * Calls an introspected class level function, such as a constructor, that
+ * was defined by {Gtk3::Object.method_missing}.
+ *
+ * @since  2026-10-19
+ * @param  [Array] args The arguments of the function.
+ * @return [Object]
+ */
+static VALUE gtk3_introspection_singleton_method(
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    RIntrospectionFunction *function;
+    ID name    = rb_frame_this_func();
+    GType type = gtk3_introspection_class_gtype(self);
+
+    function = gtk3_introspection_lookup(type, name, FALSE, NULL);
+
+    if ( function == NULL )
+    {
+        rb_raise(
+            rb_eNoMethodError,
+            "undefined method `%s' for %s",
+            rb_id2name(name),
+            rb_class2name(self)
+        );
+    }
+
+    if ( g_type_is_a(type, GTK_TYPE_WIDGET) )
+    {
+        gtk3_ensure_init();
+    }
+
+    return gtk3_introspection_call(function, argc, argv, self);
+}
+
+/**
+ * Defines a class for a type of the typelib, using the class of the parent
+ * type as its superclass. Types outside of the Gtk namespace and types whose
+ * name is already taken by another constant don't get a class, in which case
+ * `Qnil` is returned and the class of the closest parent type is used.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type to define a class for.
+ * @return [VALUE]
+ */
+VALUE gtk3_introspection_class(GType type)
+{
+    GIBaseInfo *info;
+    VALUE klass;
+    VALUE parent;
+    RIntrospectionFunction *constructor;
+    const gchar *name = NULL;
+    gpointer key      = GSIZE_TO_POINTER(type);
+
+    if ( g_hash_table_contains(gtk3_introspection_unresolved, key)
+    || !gtk3_introspection_require() )
+    {
+        return Qnil;
+    }
+
+    info = g_irepository_find_by_gtype(NULL, type);
+
+    /* Names point into the typelib, which stays loaded. */
+    if ( info != NULL
+    && g_base_info_get_type(info) == GI_INFO_TYPE_OBJECT
+    && !strcmp(g_base_info_get_namespace(info), GTK3_INTROSPECTION_NAMESPACE) )
+    {
+        name = g_base_info_get_name(info);
+    }
+
+    if ( name != NULL && rb_const_defined_at(gtk3_mGtk3, rb_intern(name)) )
+    {
+        name = NULL;
+    }
+
+    if ( info != NULL )
+    {
+        g_base_info_unref(info);
+    }
+
+    if ( name == NULL )
+    {
+        g_hash_table_add(gtk3_introspection_unresolved, key);
+
+        return Qnil;
+    }
+
+    parent = gtk3_object_class(g_type_parent(type));
+    klass  = rb_define_class_under(gtk3_mGtk3, name, parent);
+
+    gtk3_object_register_class(type, klass);
+
+    /* Class#new can't be used for GObjects, so method_missing never sees it. */
+    constructor = gtk3_introspection_cached(type, gtk3_id_new);
+
+    if ( constructor != NULL && constructor->instance_type == 0 )
+    {
+        rb_define_singleton_method(
+            klass,
+            "new",
+            gtk3_introspection_singleton_method,
+            -1
+        );
+    }
+
+    return klass;
+}
+
+/* Class methods */
+
+/**
+ * Defines classes for the types of the Gtk typelib when they're first
+ * referenced.
+ *
+ * @example
+ *  Gtk3::Label # => Gtk3::Label
+ *
+ * @since  2026-10-19
+ * @param  [Symbol] name The name of the constant.
+ * @raise  [NameError] Raised when the typelib doesn't define the type.
+ * @return [Class]
+ */
+static VALUE gtk3_introspection_const_missing(VALUE self, VALUE name)
+{
+    GIBaseInfo *info;
+    GType type = G_TYPE_INVALID;
+
+    if ( SYMBOL_P(name) && gtk3_introspection_require() )
+    {
+        info = g_irepository_find_by_name(
+            NULL,
+            GTK3_INTROSPECTION_NAMESPACE,
+            rb_id2name(SYM2ID(name))
+        );
+
+        if ( info && g_base_info_get_type(info) == GI_INFO_TYPE_OBJECT )
+        {
+            type = g_registered_type_info_get_g_type(
+                (GIRegisteredTypeInfo *) info
+            );
+        }
+
+        if ( info )
+        {
+            g_base_info_unref(info);
+        }
+    }
+
+    if ( type != G_TYPE_INVALID && type != G_TYPE_NONE )
+    {
+        gtk3_object_class(type);
+
+        if ( rb_const_defined_at(self, SYM2ID(name)) )
+        {
+            return rb_const_get_at(self, SYM2ID(name));
+        }
+    }
+
+    return rb_call_super(1, &name);
+}
+
+/**
+ * Defines a class level function, such as a constructor, of the typelib the
+ * first time it's called. Later calls use the defined method directly.
+ *
+ * @example
+ *  Gtk3::Label.new_with_mnemonic('_Save')
+ *
+ * @since  2026-10-19
+ * @param  [Symbol] name The name of the method.
+ * @param  [Array] args The arguments of the method.
+ * @raise  [NoMethodError] Raised when the function doesn't exist or isn't
+ *  supported.
+ * @return [Object]
+ */
+static VALUE gtk3_introspection_singleton_method_missing(
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    GType type;
+    GType declaring                  = 0;
+    RIntrospectionFunction *function = NULL;
+
+    type = gtk3_introspection_class_gtype(self);
+
+    if ( argc > 0 && SYMBOL_P(argv[0]) && type != 0 )
+    {
+        function = gtk3_introspection_lookup(
+            type,
+            SYM2ID(argv[0]),
+            FALSE,
+            &declaring
+        );
+    }
+
+    if ( function == NULL )
+    {
+        return rb_call_super(argc, argv);
+    }
+
+    rb_define_singleton_method(
+        gtk3_object_class(declaring),
+        rb_id2name(SYM2ID(argv[0])),
+        gtk3_introspection_singleton_method,
+        -1
+    );
+
+    if ( g_type_is_a(type, GTK_TYPE_WIDGET) )
+    {
+        gtk3_ensure_init();
+    }
+
+    return gtk3_introspection_call(function, argc - 1, argv + 1, self);
+}
+
+/* Instance methods */
+
+/**
+ * Defines a method of the typelib the first time it's called. The method is
+ * defined on the class of the type that declares it, later calls use the
+ * defined method directly. Methods that use argument types that can't be
+ * converted, such as output arguments and callbacks, aren't supported.
+ *
+ * @example
+ *  label = Gtk3.create(:GtkLabel)
+ *
+ *  label.set_text('Saved') # defines Gtk3::Label#set_text
+ *
+ * @since  2026-10-19
+ * @param  [Symbol] name The name of the method.
+ * @param  [Array] args The arguments of the method.
+ * @raise  [NoMethodError] Raised when the method doesn't exist or isn't
+ *  supported.
+ * @return [Object]
+ */
+static VALUE gtk3_introspection_method_missing(
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    GObject *object;
+    GType declaring                  = 0;
+    RIntrospectionFunction *function = NULL;
+
+    Data_Get_Struct(self, GObject, object);
+
+    if ( argc > 0 && SYMBOL_P(argv[0]) )
+    {
+        function = gtk3_introspection_lookup(
+            G_OBJECT_TYPE(object),
+            SYM2ID(argv[0]),
+            TRUE,
+            &declaring
+        );
+    }
+
+    if ( function == NULL )
+    {
+        return rb_call_super(argc, argv);
+    }
+
+    rb_define_method(
+        gtk3_object_class(declaring),
+        rb_id2name(SYM2ID(argv[0])),
+        gtk3_introspection_method,
+        -1
+    );
+
+    return gtk3_introspection_call(function, argc - 1, argv + 1, self);
+}
+
+/**
+ * Returns `true` if the object responds to a method of the typelib that
+ * hasn't been defined yet.
+ *
+ * @since  2026-10-19
+ * @param  [Symbol] name The name of the method.
+ * @param  [TrueClass|FalseClass] include_private Unused.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_introspection_respond_to_missing(
+    VALUE self,
+    VALUE name,
+    VALUE include_private
+)
+{
+    GObject *object;
+
+    Data_Get_Struct(self, GObject, object);
+
+    if ( !SYMBOL_P(name) )
+    {
+        return Qfalse;
+    }
+
+    return gtk3_introspection_lookup(
+        G_OBJECT_TYPE(object),
+        SYM2ID(name),
+        TRUE,
+        NULL
+    ) ? Qtrue : Qfalse;
+}
+
+#endif
+
+/**
+ * Sets up the classes and methods defined using GObject Introspection. When
+ * the extension is built without introspection support only
+ * {Gtk3::INTROSPECTION} is defined.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_introspection()
+{
+#ifdef HAVE_GI
+    gtk3_introspection_functions = g_hash_table_new(
+        g_direct_hash,
+        g_direct_equal
+    );
+
+    gtk3_introspection_unresolved = g_hash_table_new(
+        g_direct_hash,
+        g_direct_equal
+    );
+
+    rb_define_const(gtk3_mGtk3, "INTROSPECTION", Qtrue);
+
+    rb_define_singleton_method(
+        gtk3_mGtk3,
+        "const_missing",
+        gtk3_introspection_const_missing,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_cObject,
+        "method_missing",
+        gtk3_introspection_singleton_method_missing,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cObject,
+        "method_missing",
+        gtk3_introspection_method_missing,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cObject,
+        "respond_to_missing?",
+        gtk3_introspection_respond_to_missing,
+        2
+    );
+#else
+    rb_define_const(gtk3_mGtk3, "INTROSPECTION", Qfalse);
+#endif
+}
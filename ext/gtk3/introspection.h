@@ -0,0 +1,63 @@
+#ifndef GTK3_INTROSPECTION
+#define GTK3_INTROSPECTION
+
+#include "gtk3.h"
+
+#ifdef HAVE_GI
+#include <girepository.h>
+#include <girffi.h>
+
+/**
+ * Structure describing an argument or return value of an introspected
+ * function.
+ *
+ * * tag: the type tag of the value.
+ * * type: the GType used for converting the value using a GValue.
+ * * transfer: the ownership transfer of the value.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RIntrospectionArg
+{
+    GITypeTag tag;
+    GType type;
+    GITransfer transfer;
+} RIntrospectionArg;
+
+/**
+ * Structure containing a function of a typelib along with its prepared
+ * invoker. Functions are prepared once and kept for the lifetime of the
+ * process.
+ *
+ * * info: the function info.
+ * * invoker: the libffi invoker of the function.
+ * * instance_type: the type of the instance argument, 0 for functions that
+ *   aren't methods.
+ * * constructor: whether the function is a constructor.
+ * * throws: whether the function takes a GError argument.
+ * * n_args: the amount of arguments, excluding the instance and GError.
+ * * args: the arguments of the function.
+ * * result: the return value of the function.
+ * * result_info: the type info of the return value.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RIntrospectionFunction
+{
+    GIFunctionInfo *info;
+    GIFunctionInvoker invoker;
+    GType instance_type;
+    gboolean constructor;
+    gboolean throws;
+    gint n_args;
+    RIntrospectionArg *args;
+    RIntrospectionArg result;
+    GITypeInfo *result_info;
+} RIntrospectionFunction;
+
+extern VALUE gtk3_introspection_class(GType type);
+#endif
+
+extern void Init_gtk3_introspection();
+
+#endif
@@ -0,0 +1,737 @@
+#include "key_sequence.h"
+
+/**
+ * Quark used for storing the RKeySequences of a window.
+ *
+ * @since 2026-10-19
+ */
+static GQuark gtk3_key_sequence_quark;
+
+/**
+ * The default amount of milliseconds to wait for the next keystroke.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_KEY_SEQUENCE_TIMEOUT 1000
+
+/**
+ * Hashes the keystroke of a node.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] data The node to hash.
+ * @return [guint]
+ */
+static guint gtk3_key_node_hash(gconstpointer data)
+{
+    const RKeyNode *node = data;
+
+    return node->key ^ ((guint) node->modifier << 16);
+}
+
+/**
+ * Returns TRUE if two nodes are for the same keystroke.
+ *
+ * @since  2026-10-19
+ * @param  [gconstpointer] a The first node.
+ * @param  [gconstpointer] b The second node.
+ * @return [gboolean]
+ */
+static gboolean gtk3_key_node_equal(gconstpointer a, gconstpointer b)
+{
+    const RKeyNode *node_a = a;
+    const RKeyNode *node_b = b;
+
+    return node_a->key == node_b->key && node_a->modifier == node_b->modifier;
+}
+
+/**
+ * Frees a node and all of its children.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The node to free.
+ */
+static void gtk3_key_node_free(gpointer data)
+{
+    RKeyNode *node = (RKeyNode *) data;
+
+    g_hash_table_destroy(node->children);
+    g_free(node->sequence);
+    g_free(node);
+}
+
+/**
+ * Creates a new node.
+ *
+ * @since  2026-10-19
+ * @param  [RKeyNode *] parent The parent node or NULL for the root node.
+ * @param  [guint] key The key of the keystroke.
+ * @param  [GdkModifierType] modifier The modifier of the keystroke.
+ * @return [RKeyNode *]
+ */
+static RKeyNode *gtk3_key_node_new(
+    RKeyNode *parent,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    gchar *name;
+    RKeyNode *node = g_new(RKeyNode, 1);
+
+    node->key      = key;
+    node->modifier = modifier;
+    node->callable = Qnil;
+    node->children = g_hash_table_new_full(
+        gtk3_key_node_hash,
+        gtk3_key_node_equal,
+        NULL,
+        gtk3_key_node_free
+    );
+
+    if ( parent == NULL )
+    {
+        node->sequence = g_strdup("");
+    }
+    else
+    {
+        name = gtk_accelerator_name(key, modifier);
+
+        if ( parent->sequence[0] == '\0' )
+        {
+            node->sequence = name;
+        }
+        else
+        {
+            node->sequence = g_strconcat(parent->sequence, " ", name, NULL);
+
+            g_free(name);
+        }
+
+        g_hash_table_replace(parent->children, node, node);
+    }
+
+    return node;
+}
+
+/**
+ * Returns the child of a node for the given keystroke, or NULL.
+ *
+ * @since  2026-10-19
+ * @param  [RKeyNode *] node The parent node.
+ * @param  [guint] key The key of the keystroke.
+ * @param  [GdkModifierType] modifier The modifier of the keystroke.
+ * @return [RKeyNode *]
+ */
+static RKeyNode *gtk3_key_node_child(
+    RKeyNode *node,
+    guint key,
+    GdkModifierType modifier
+)
+{
+    RKeyNode query;
+
+    query.key      = key;
+    query.modifier = modifier;
+
+    return g_hash_table_lookup(node->children, &query);
+}
+
+/**
+ * Marks the callables of a node and its children.
+ *
+ * @since 2026-10-19
+ * @param [RKeyNode *] node The node to mark.
+ */
+static void gtk3_key_node_mark(RKeyNode *node)
+{
+    GHashTableIter iter;
+    gpointer child;
+
+    rb_gc_mark(node->callable);
+
+    g_hash_table_iter_init(&iter, node->children);
+
+    while ( g_hash_table_iter_next(&iter, &child, NULL) )
+    {
+        gtk3_key_node_mark((RKeyNode *) child);
+    }
+}
+
+/**
+ * Marks the callables and prefix hook of a window.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The RKeySequences structure, or NULL once the window
+ *  has been finalized.
+ */
+static void gtk3_key_sequence_mark(void *data)
+{
+    RKeySequences *sequences = (RKeySequences *) data;
+
+    if ( sequences != NULL )
+    {
+        rb_gc_mark(sequences->prefix_hook);
+
+        gtk3_key_node_mark(sequences->root);
+    }
+}
+
+/**
+ * Frees the key sequences of a window once the window is finalized.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The RKeySequences structure.
+ */
+static void gtk3_key_sequence_free(gpointer data)
+{
+    RKeySequences *sequences = (RKeySequences *) data;
+
+    if ( sequences->timeout_id > 0 )
+    {
+        g_source_remove(sequences->timeout_id);
+    }
+
+    DATA_PTR(sequences->keeper) = NULL;
+
+    rb_gc_unregister_address(&sequences->keeper);
+
+    gtk3_key_node_free(sequences->root);
+
+    g_free(sequences);
+}
+
+/**
+ * Calls the prefix hook of a window, if any. The hook is called from the main
+ * loop, exceptions are raised once control returns to Ruby.
+ *
+ * @since 2026-10-19
+ * @param [RKeySequences *] sequences The key sequences of the window.
+ * @param [RKeyNode *] node The node of the current prefix or NULL when the
+ *  current sequence was cancelled.
+ */
+static void gtk3_key_sequence_notify(RKeySequences *sequences, RKeyNode *node)
+{
+    if ( NIL_P(sequences->prefix_hook) )
+    {
+        return;
+    }
+
+    gtk3_call_protected(
+        sequences->prefix_hook,
+        node ? gtk3_utf8_new(node->sequence) : Qnil
+    );
+}
+
+/**
+ * Resets the state of the sequence that is currently being typed.
+ *
+ * @since 2026-10-19
+ * @param [RKeySequences *] sequences The key sequences of the window.
+ */
+static void gtk3_key_sequence_reset(RKeySequences *sequences)
+{
+    sequences->current = sequences->root;
+
+    if ( sequences->timeout_id > 0 )
+    {
+        g_source_remove(sequences->timeout_id);
+
+        sequences->timeout_id = 0;
+    }
+}
+
+/**
+ * Cancels the current sequence once the timeout expires.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data The RKeySequences structure.
+ * @return [gboolean]
+ */
+static gboolean gtk3_key_sequence_timeout(gpointer data)
+{
+    RKeySequences *sequences = (RKeySequences *) data;
+
+    sequences->timeout_id = 0;
+    sequences->current    = sequences->root;
+
+    gtk3_key_sequence_notify(sequences, NULL);
+
+    return FALSE;
+}
+
+/**
+ * Handles the key presses of a window. Keystrokes are matched against the
+ * trie without calling into Ruby, Ruby code is only called when a sequence is
+ * completed, or for prefix feedback when a prefix hook is set. Exceptions
+ * raised by the Ruby code are raised once control returns to Ruby.
+ *
+ * @since  2026-10-19
+ * @param  [GtkWidget *] widget The window.
+ * @param  [GdkEventKey *] event The key event.
+ * @param  [gpointer] data The RKeySequences structure.
+ * @return [gboolean]
+ */
+static gboolean gtk3_key_sequence_key_press(
+    GtkWidget *widget,
+    GdkEventKey *event,
+    gpointer data
+)
+{
+    guint key;
+    GdkModifierType modifier;
+    RKeyNode *node;
+    VALUE callable;
+    gboolean pending;
+    RKeySequences *sequences = (RKeySequences *) data;
+
+    if ( event->is_modifier )
+    {
+        return FALSE;
+    }
+
+    key      = gdk_keyval_to_lower(event->keyval);
+    modifier = event->state & gtk_accelerator_get_default_mod_mask();
+    node     = gtk3_key_node_child(sequences->current, key, modifier);
+    pending  = sequences->current != sequences->root;
+
+    if ( node == NULL )
+    {
+        /* Keys that don't start a sequence are handled by GTK as usual. */
+        if ( !pending )
+        {
+            return FALSE;
+        }
+
+        gtk3_key_sequence_reset(sequences);
+        gtk3_key_sequence_notify(sequences, NULL);
+
+        return TRUE;
+    }
+
+    if ( !NIL_P(node->callable) )
+    {
+        callable = node->callable;
+
+        gtk3_key_sequence_reset(sequences);
+
+        if ( pending )
+        {
+            gtk3_key_sequence_notify(sequences, NULL);
+        }
+
+        gtk3_call_protected(
+            callable,
+            gtk3_object_wrap(Qnil, widget, FALSE)
+        );
+
+        return TRUE;
+    }
+
+    gtk3_key_sequence_reset(sequences);
+
+    sequences->current    = node;
+    sequences->timeout_id = g_timeout_add(
+        sequences->timeout,
+        gtk3_key_sequence_timeout,
+        sequences
+    );
+
+    gtk3_key_sequence_notify(sequences, node);
+
+    return TRUE;
+}
+
+/**
+ * Returns the key sequences of a window, creating them if needed.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] self The window.
+ * @return [RKeySequences *]
+ */
+static RKeySequences *gtk3_key_sequence_get(VALUE self)
+{
+    GtkWidget *window;
+    RKeySequences *sequences;
+
+    Data_Get_Struct(self, GtkWidget, window);
+
+    sequences = g_object_get_qdata(G_OBJECT(window), gtk3_key_sequence_quark);
+
+    if ( sequences != NULL )
+    {
+        return sequences;
+    }
+
+    sequences              = g_new(RKeySequences, 1);
+    sequences->window      = window;
+    sequences->root        = gtk3_key_node_new(NULL, 0, 0);
+    sequences->current     = sequences->root;
+    sequences->timeout     = GTK3_KEY_SEQUENCE_TIMEOUT;
+    sequences->timeout_id  = 0;
+    sequences->prefix_hook = Qnil;
+    sequences->keeper      = Data_Wrap_Struct(
+        0,
+        gtk3_key_sequence_mark,
+        NULL,
+        sequences
+    );
+
+    rb_gc_register_address(&sequences->keeper);
+
+    g_object_set_qdata_full(
+        G_OBJECT(window),
+        gtk3_key_sequence_quark,
+        sequences,
+        gtk3_key_sequence_free
+    );
+
+    g_signal_connect(
+        window,
+        "key-press-event",
+        G_CALLBACK(gtk3_key_sequence_key_press),
+        sequences
+    );
+
+    return sequences;
+}
+
+/**
+ * Parses a key sequence such as "<Control>x <Control>s" into an array of
+ * keystrokes.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] sequence The key sequence.
+ * @param  [GtkAccelKey *] keys The array to store the keystrokes in.
+ * @param  [guint] size The size of the array.
+ * @raise  [ArgumentError] Raised when the sequence is invalid.
+ * @return [guint] The amount of keystrokes.
+ */
+static guint gtk3_key_sequence_parse(
+    VALUE sequence,
+    GtkAccelKey *keys,
+    guint size
+)
+{
+    guint length = 0;
+    gchar **strokes;
+    gchar **stroke;
+    guint key;
+    GdkModifierType modifier;
+
+    strokes = g_strsplit_set(gtk3_string_value_utf8(&sequence), " \t", -1);
+
+    for ( stroke = strokes; *stroke != NULL; stroke++ )
+    {
+        if ( **stroke == '\0' )
+        {
+            continue;
+        }
+
+        gtk_accelerator_parse(*stroke, &key, &modifier);
+
+        if ( key == 0 || length == size )
+        {
+            length = 0;
+
+            break;
+        }
+
+        keys[length].accel_key   = gdk_keyval_to_lower(key);
+        keys[length].accel_mods  = modifier;
+        keys[length].accel_flags = 0;
+
+        length++;
+    }
+
+    g_strfreev(strokes);
+
+    if ( length == 0 )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid key sequence %s",
+            RSTRING_PTR(sequence)
+        );
+    }
+
+    return length;
+}
+
+/**
+ * The maximum amount of keystrokes in a single sequence.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_KEY_SEQUENCE_MAX 16
+
+/**
+ * Binds a key sequence to a block or callable. Keystrokes are separated by
+ * spaces and use the same syntax as accelerators. The callable is called with
+ * the window as its only argument once the full sequence is typed.
+ *
+ * A sequence can't be the prefix of another sequence, e.g. "<Control>x" can't
+ * be bound when "<Control>x <Control>s" is bound. Binding a sequence that is
+ * already bound replaces its callable.
+ *
+ * @example
+ *  window.bind_sequence('<Control>x <Control>s') { |window| save }
+ *  window.bind_sequence('<Control>x <Control>c', method(:quit))
+ *
+ * @since  2026-10-19
+ * @param  [String] sequence The key sequence.
+ * @param  [#call] callable The object to call, defaults to the block.
+ * @raise  [ArgumentError] Raised when the sequence is invalid or conflicts
+ *  with an existing sequence.
+ * @return [Gtk3::Window]
+ */
+static VALUE gtk3_window_bind_sequence(int argc, VALUE *argv, VALUE self)
+{
+    VALUE sequence;
+    VALUE callable;
+    VALUE block;
+    GtkAccelKey keys[GTK3_KEY_SEQUENCE_MAX];
+    guint length;
+    guint index;
+    RKeyNode *node;
+    RKeyNode *child;
+    RKeySequences *sequences;
+
+    rb_scan_args(argc, argv, "11&", &sequence, &callable, &block);
+
+    if ( NIL_P(callable) )
+    {
+        callable = block;
+    }
+
+    if ( !rb_respond_to(callable, gtk3_id_call) )
+    {
+        rb_raise(rb_eArgError, "a block or callable object is required");
+    }
+
+    length = gtk3_key_sequence_parse(sequence, keys, GTK3_KEY_SEQUENCE_MAX);
+
+    sequences = gtk3_key_sequence_get(self);
+    node      = sequences->root;
+
+    /* Check for conflicts before changing anything. */
+    for ( index = 0; index < length; index++ )
+    {
+        node = gtk3_key_node_child(
+            node,
+            keys[index].accel_key,
+            keys[index].accel_mods
+        );
+
+        if ( node == NULL )
+        {
+            break;
+        }
+
+        /* An existing sequence is a prefix of the new one or vice versa. */
+        if ( (index < length - 1 && !NIL_P(node->callable))
+        || (index == length - 1 && g_hash_table_size(node->children) > 0) )
+        {
+            rb_raise(
+                rb_eArgError,
+                "%s conflicts with the sequence %s",
+                RSTRING_PTR(sequence),
+                node->sequence
+            );
+        }
+    }
+
+    gtk3_key_sequence_reset(sequences);
+
+    node = sequences->root;
+
+    for ( index = 0; index < length; index++ )
+    {
+        child = gtk3_key_node_child(
+            node,
+            keys[index].accel_key,
+            keys[index].accel_mods
+        );
+
+        if ( child == NULL )
+        {
+            child = gtk3_key_node_new(
+                node,
+                keys[index].accel_key,
+                keys[index].accel_mods
+            );
+        }
+
+        node = child;
+    }
+
+    node->callable = callable;
+
+    return self;
+}
+
+/**
+ * Removes a key sequence. Returns true if the sequence was bound.
+ *
+ * @example
+ *  window.unbind_sequence('<Control>x <Control>s') # => true
+ *
+ * @since  2026-10-19
+ * @param  [String] sequence The key sequence to remove.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_window_unbind_sequence(VALUE self, VALUE sequence)
+{
+    GtkAccelKey keys[GTK3_KEY_SEQUENCE_MAX];
+    RKeyNode *path[GTK3_KEY_SEQUENCE_MAX + 1];
+    guint length;
+    guint index;
+    RKeySequences *sequences;
+
+    length    = gtk3_key_sequence_parse(sequence, keys, GTK3_KEY_SEQUENCE_MAX);
+    sequences = gtk3_key_sequence_get(self);
+    path[0]   = sequences->root;
+
+    for ( index = 0; index < length; index++ )
+    {
+        path[index + 1] = gtk3_key_node_child(
+            path[index],
+            keys[index].accel_key,
+            keys[index].accel_mods
+        );
+
+        if ( path[index + 1] == NULL )
+        {
+            return Qfalse;
+        }
+    }
+
+    if ( NIL_P(path[length]->callable) )
+    {
+        return Qfalse;
+    }
+
+    gtk3_key_sequence_reset(sequences);
+
+    path[length]->callable = Qnil;
+
+    /* Remove the nodes that are no longer part of any sequence. */
+    for ( index = length; index > 0; index-- )
+    {
+        if ( g_hash_table_size(path[index]->children) > 0
+        || !NIL_P(path[index]->callable) )
+        {
+            break;
+        }
+
+        g_hash_table_remove(path[index - 1]->children, path[index]);
+    }
+
+    return Qtrue;
+}
+
+/**
+ * Sets the amount of milliseconds to wait for the next keystroke of a
+ * sequence before the sequence is cancelled. The default is 1000.
+ *
+ * @since 2026-10-19
+ * @param [Fixnum] timeout The timeout in milliseconds.
+ */
+static VALUE gtk3_window_set_sequence_timeout(VALUE self, VALUE timeout)
+{
+    gtk3_check_number(timeout);
+
+    gtk3_key_sequence_get(self)->timeout = NUM2UINT(timeout);
+
+    return Qnil;
+}
+
+/**
+ * Returns the timeout of key sequences in milliseconds.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_window_get_sequence_timeout(VALUE self)
+{
+    GtkWidget *window;
+    RKeySequences *sequences;
+
+    Data_Get_Struct(self, GtkWidget, window);
+
+    /* Reading the timeout shouldn't start listening for key presses. */
+    sequences = g_object_get_qdata(G_OBJECT(window), gtk3_key_sequence_quark);
+
+    if ( sequences == NULL )
+    {
+        return UINT2NUM(GTK3_KEY_SEQUENCE_TIMEOUT);
+    }
+
+    return UINT2NUM(sequences->timeout);
+}
+
+/**
+ * Sets a block that's called whenever a prefix of a sequence is typed, for
+ * example to show the keys typed so far in a status bar. The block receives
+ * the prefix as a String, or nil when the sequence is cancelled because of an
+ * unbound key or the timeout. Calling this method without a block removes the
+ * hook.
+ *
+ * @example
+ *  window.on_sequence_prefix do |prefix|
+ *    status.text = prefix ? "#{prefix} -" : ''
+ *  end
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_window_on_sequence_prefix(VALUE self)
+{
+    gtk3_key_sequence_get(self)->prefix_hook = rb_block_given_p()
+        ? rb_block_proc()
+        : Qnil;
+
+    return Qnil;
+}
+
+/**
+ * Sets up the key sequence methods of {Gtk3::Window}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_key_sequence()
+{
+    gtk3_key_sequence_quark = g_quark_from_static_string("gtk3-key-sequences");
+
+    rb_define_method(
+        gtk3_cWindow,
+        "bind_sequence",
+        gtk3_window_bind_sequence,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cWindow,
+        "unbind_sequence",
+        gtk3_window_unbind_sequence,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cWindow,
+        "sequence_timeout=",
+        gtk3_window_set_sequence_timeout,
+        1
+    );
+
+    rb_define_method(
+        gtk3_cWindow,
+        "sequence_timeout",
+        gtk3_window_get_sequence_timeout,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cWindow,
+        "on_sequence_prefix",
+        gtk3_window_on_sequence_prefix,
+        0
+    );
+}
@@ -0,0 +1,47 @@
+#ifndef GTK3_KEY_SEQUENCE
+#define GTK3_KEY_SEQUENCE
+
+#include "gtk3.h"
+
+/**
+ * Node in the trie of key sequences bound to a window. Each node represents a
+ * single keystroke, nodes with a callable are complete sequences and never
+ * have any children.
+ *
+ * * key: the key of the keystroke.
+ * * modifier: the modifier of the keystroke.
+ * * sequence: the name of the sequence up to and including this node.
+ * * callable: the object to call for a complete sequence, or nil.
+ * * children: hash table of the next keystrokes.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RKeyNode
+{
+    guint key;
+    GdkModifierType modifier;
+    gchar *sequence;
+    VALUE callable;
+    GHashTable *children;
+} RKeyNode;
+
+/**
+ * Structure containing the key sequences of a window and the state of the
+ * sequence that is currently being typed. It's stored as qdata on the window.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RKeySequences
+{
+    GtkWidget *window;
+    RKeyNode *root;
+    RKeyNode *current;
+    guint timeout;
+    guint timeout_id;
+    VALUE prefix_hook;
+    VALUE keeper;
+} RKeySequences;
+
+extern void Init_gtk3_key_sequence();
+
+#endif
@@ -0,0 +1,622 @@
+#include "object.h"
+
+/**
+ * Document-class: Gtk3::Object
+ *
+ * {Gtk3::Object} is the base class of all classes that wrap a GObject. It
+ * provides access to the properties of objects and is used for objects of
+ * which the type has no dedicated Ruby class.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cObject;
+
+/**
+ * Quark used for storing the RWrapper of a GObject.
+ *
+ * @since 2026-10-19
+ */
+static GQuark gtk3_object_quark;
+
+/**
+ * Hash table that maps GTypes to the Ruby classes that represent them.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_object_classes;
+
+/**
+ * Hash table that maps Ruby classes to the GTypes they represent.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_object_gtypes;
+
+/**
+ * Hash table that maps the IDs of type names to their GTypes.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_object_type_names;
+
+/**
+ * Builder used for resolving type names of types that haven't been registered
+ * with GObject yet.
+ *
+ * @since 2026-10-19
+ */
+static GtkBuilder *gtk3_object_type_resolver;
+
+/**
+ * Objects of which the Ruby object has been garbage collected. These objects
+ * are unreferenced outside of the garbage collector as dropping the last
+ * reference may result in signal handlers (and thus Ruby code) being called.
+ *
+ * @since 2026-10-19
+ */
+static GPtrArray *gtk3_object_pending_unrefs;
+
+/**
+ * ObjectSpace::WeakMap that maps every Ruby object wrapping a GObject to
+ * itself. Looking up an object that the garbage collector found to be garbage
+ * returns nil, even if the object hasn't been swept yet. Set to nil on Ruby
+ * versions without weak maps.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_object_live_wrappers = Qnil;
+
+/**
+ * ID for the `:[]` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_aref;
+
+/**
+ * ID for the `:[]=` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_aset;
+
+/**
+ * Drops the references of the objects in gtk3_object_pending_unrefs.
+ *
+ * @since  2026-10-19
+ * @param  [gpointer] data Unused.
+ * @return [gboolean]
+ */
+static gboolean gtk3_object_unref_pending(gpointer data)
+{
+    GPtrArray *objects = gtk3_object_pending_unrefs;
+    guint index;
+
+    if ( objects->len == 0 )
+    {
+        return FALSE;
+    }
+
+    gtk3_object_pending_unrefs = g_ptr_array_new();
+
+    for ( index = 0; index < objects->len; index++ )
+    {
+        g_object_unref(g_ptr_array_index(objects, index));
+    }
+
+    g_ptr_array_free(objects, TRUE);
+
+    return FALSE;
+}
+
+/**
+ * Returns `TRUE` if the Ruby object of the given wrapper is known to be alive.
+ * Ruby objects that weren't marked by the garbage collector may be swept at
+ * any time, handing them out again would result in them being used after
+ * they have been freed. Without weak maps there's no way of telling whether
+ * an object is garbage, in that case Ruby objects are never handed out again.
+ *
+ * @since  2026-10-19
+ * @param  [RWrapper *] wrapper The wrapper to check.
+ * @return [gboolean]
+ */
+static gboolean gtk3_object_wrapper_alive(RWrapper *wrapper)
+{
+    if ( NIL_P(gtk3_object_live_wrappers) )
+    {
+        return FALSE;
+    }
+
+    return rb_funcall(
+        gtk3_object_live_wrappers,
+        gtk3_id_aref,
+        1,
+        wrapper->self
+    ) == wrapper->self;
+}
+
+/**
+ * Free function for Ruby objects that wrap a GObject. The link between the
+ * GObject and its Ruby objects is removed once the last of them is freed, the
+ * reference held by the Ruby object is dropped once control returns to the
+ * main loop.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The GObject.
+ */
+static void gtk3_object_free(void *data)
+{
+    RWrapper *wrapper = g_object_get_qdata(data, gtk3_object_quark);
+
+    if ( wrapper != NULL && --wrapper->wrappers == 0 )
+    {
+        g_object_set_qdata(data, gtk3_object_quark, NULL);
+    }
+
+    if ( gtk3_object_pending_unrefs->len == 0 )
+    {
+        g_idle_add(gtk3_object_unref_pending, NULL);
+    }
+
+    g_ptr_array_add(gtk3_object_pending_unrefs, data);
+}
+
+/**
+ * Returns the Ruby object for a GObject. If the GObject already has a Ruby
+ * object that is alive that object is returned, otherwise a new one is
+ * created. The Ruby object holds a reference to the GObject, keeping it alive
+ * for as long as the Ruby object exists.
+ *
+ * Floating references are always sunk. When `owned` is set to `TRUE` the
+ * caller's reference is transferred to the Ruby object, otherwise a new
+ * reference is added.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] klass The class of the Ruby object, or Qnil to use the
+ *  class registered for the type of the GObject.
+ * @param  [gpointer] object The GObject to wrap.
+ * @param  [gboolean] owned Whether the caller's reference is transferred.
+ * @raise  [TypeError] Raised when no class is registered for the type.
+ * @return [VALUE]
+ */
+VALUE gtk3_object_wrap(VALUE klass, gpointer object, gboolean owned)
+{
+    RWrapper *wrapper;
+
+    if ( object == NULL )
+    {
+        return Qnil;
+    }
+
+    gtk3_object_unref_pending(NULL);
+
+    wrapper = g_object_get_qdata(object, gtk3_object_quark);
+
+    if ( wrapper != NULL && gtk3_object_wrapper_alive(wrapper) )
+    {
+        if ( owned && !g_object_is_floating(object) )
+        {
+            g_object_unref(object);
+        }
+
+        return wrapper->self;
+    }
+
+    if ( NIL_P(klass) )
+    {
+        klass = gtk3_object_class(G_OBJECT_TYPE(object));
+    }
+
+    if ( g_object_is_floating(object) )
+    {
+        g_object_ref_sink(object);
+    }
+    else if ( !owned )
+    {
+        g_object_ref(object);
+    }
+
+    /*
+    Accelerator groups can also be created by GTK (e.g. by GtkBuilder), these
+    are tracked as soon as they're passed to Ruby.
+    */
+    if ( GTK_IS_ACCEL_GROUP(object) )
+    {
+        gtk3_accel_index_track_group(GTK_ACCEL_GROUP(object));
+    }
+
+    /*
+    A previous Ruby object that is about to be swept keeps its own reference
+    until it's freed, hence the wrapper counter.
+    */
+    if ( wrapper == NULL )
+    {
+        wrapper           = g_new(RWrapper, 1);
+        wrapper->wrappers = 0;
+
+        g_object_set_qdata_full(object, gtk3_object_quark, wrapper, g_free);
+    }
+
+    wrapper->self = Data_Wrap_Struct(klass, NULL, gtk3_object_free, object);
+
+    wrapper->wrappers++;
+
+    if ( !NIL_P(gtk3_object_live_wrappers) )
+    {
+        rb_funcall(
+            gtk3_object_live_wrappers,
+            gtk3_id_aset,
+            2,
+            wrapper->self,
+            wrapper->self
+        );
+    }
+
+    return wrapper->self;
+}
+
+/**
+ * Returns the GObject wrapped by a Ruby object.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] rbobject The Ruby object.
+ * @param  [GType] type The type the GObject should be an instance of.
+ * @raise  [TypeError] Raised when the Ruby object does not wrap a GObject of
+ *  the given type.
+ * @return [gpointer]
+ */
+gpointer gtk3_object_unwrap(VALUE rbobject, GType type)
+{
+    gpointer object;
+
+    if ( TYPE(rbobject) != T_DATA
+    || RDATA(rbobject)->dfree != gtk3_object_free )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong argument type %s (expected %s)",
+            gtk3_get_rbclass(rbobject),
+            g_type_name(type)
+        );
+    }
+
+    object = DATA_PTR(rbobject);
+
+    if ( !g_type_is_a(G_OBJECT_TYPE(object), type) )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "wrong object type %s (expected %s)",
+            G_OBJECT_TYPE_NAME(object),
+            g_type_name(type)
+        );
+    }
+
+    return object;
+}
+
+/**
+ * Registers the Ruby class to use for instances of the given GType and its
+ * subtypes.
+ *
+ * @since 2026-10-19
+ * @param [GType] type The GType.
+ * @param [VALUE] klass The Ruby class.
+ */
+void gtk3_object_register_class(GType type, VALUE klass)
+{
+    g_hash_table_insert(
+        gtk3_object_classes,
+        GSIZE_TO_POINTER(type),
+        (gpointer) klass
+    );
+
+    g_hash_table_insert(
+        gtk3_object_gtypes,
+        (gpointer) klass,
+        GSIZE_TO_POINTER(type)
+    );
+}
+
+/**
+ * Returns the Ruby class registered for the given GType or the closest parent
+ * type. When built with introspection support, classes are defined for types
+ * of the Gtk typelib the first time they're needed.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The GType.
+ * @raise  [TypeError] Raised when no class is registered for the type.
+ * @return [VALUE]
+ */
+VALUE gtk3_object_class(GType type)
+{
+    GType current = type;
+    gpointer klass;
+#ifdef HAVE_GI
+    VALUE introspected;
+
+    klass = g_hash_table_lookup(gtk3_object_classes, GSIZE_TO_POINTER(type));
+
+    if ( klass != NULL )
+    {
+        return (VALUE) klass;
+    }
+
+    introspected = gtk3_introspection_class(type);
+
+    if ( !NIL_P(introspected) )
+    {
+        return introspected;
+    }
+#endif
+
+    while ( current != 0 )
+    {
+        klass = g_hash_table_lookup(
+            gtk3_object_classes,
+            GSIZE_TO_POINTER(current)
+        );
+
+        if ( klass != NULL )
+        {
+            return (VALUE) klass;
+        }
+
+        current = g_type_parent(current);
+    }
+
+    rb_raise(rb_eTypeError, "no class registered for %s", g_type_name(type));
+}
+
+/**
+ * Returns the GType of a Ruby class. Subclasses defined in Ruby use the GType
+ * of the closest registered parent class. If no GType is found 0 is returned.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] klass The Ruby class.
+ * @return [GType]
+ */
+GType gtk3_object_gtype(VALUE klass)
+{
+    gpointer type;
+
+    while ( !NIL_P(klass) )
+    {
+        type = g_hash_table_lookup(gtk3_object_gtypes, (gpointer) klass);
+
+        if ( type != NULL )
+        {
+            return GPOINTER_TO_SIZE(type);
+        }
+
+        klass = rb_class_superclass(klass);
+    }
+
+    return 0;
+}
+
+/**
+ * Resolves a GType using a Ruby class or a type name such as "GtkButton". The
+ * results for type names are cached.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] name A Class, String or Symbol.
+ * @raise  [TypeError] Raised when the name is of the wrong type.
+ * @raise  [ArgumentError] Raised when the type does not exist.
+ * @return [GType]
+ */
+GType gtk3_object_lookup_gtype(VALUE name)
+{
+    ID name_id;
+    GType type;
+
+    switch ( TYPE(name) )
+    {
+        case T_CLASS:
+            type = gtk3_object_gtype(name);
+
+            if ( type == 0 )
+            {
+                rb_raise(
+                    rb_eArgError,
+                    "no GType registered for %s",
+                    rb_class2name(name)
+                );
+            }
+
+            return type;
+
+        case T_SYMBOL:
+            name_id = SYM2ID(name);
+            break;
+
+        case T_STRING:
+            name_id = rb_intern_str(name);
+            break;
+
+        default:
+            rb_raise(
+                rb_eTypeError,
+                "wrong argument type %s (expected Class, String or Symbol)",
+                gtk3_get_rbclass(name)
+            );
+    }
+
+    type = GPOINTER_TO_SIZE(
+        g_hash_table_lookup(gtk3_object_type_names, GSIZE_TO_POINTER(name_id))
+    );
+
+    if ( type != 0 )
+    {
+        return type;
+    }
+
+    /*
+    GtkBuilder is able to resolve types that haven't been registered yet by
+    calling their get_type() function.
+    */
+    if ( gtk3_object_type_resolver == NULL )
+    {
+        gtk3_object_type_resolver = gtk_builder_new();
+    }
+
+    type = gtk_builder_get_type_from_name(
+        gtk3_object_type_resolver,
+        rb_id2name(name_id)
+    );
+
+    if ( type == G_TYPE_INVALID )
+    {
+        rb_raise(rb_eArgError, "unknown type %s", rb_id2name(name_id));
+    }
+
+    g_hash_table_insert(
+        gtk3_object_type_names,
+        GSIZE_TO_POINTER(name_id),
+        GSIZE_TO_POINTER(type)
+    );
+
+    return type;
+}
+
+/**
+ * Sets multiple properties of the object in a single call. The keys of the
+ * Hash are the property names, either in the form of "default-width" or
+ * `:default_width`. The values are converted based on the type of each
+ * property.
+ *
+ * @example
+ *  window = Gtk3::Window.new
+ *
+ *  window.set(:title => 'Example', :default_width => 200)
+ *
+ * @since  2026-10-19
+ * @param  [Hash] properties The property names and their values.
+ * @raise  [ArgumentError] Raised when a property doesn't exist or can't be
+ *  set.
+ * @raise  [TypeError] Raised when a value is of the wrong type.
+ * @return [Gtk3::Object]
+ */
+static VALUE gtk3_object_set(VALUE self, VALUE properties)
+{
+    GObject *object;
+
+    Data_Get_Struct(self, GObject, object);
+
+    gtk3_property_set_many(object, properties);
+
+    return self;
+}
+
+/**
+ * Returns the values of the given properties. If a single property name is
+ * given its value is returned, otherwise an Array containing the values is
+ * returned.
+ *
+ * @example
+ *  window = Gtk3::Window.new
+ *
+ *  window.set(:title => 'Example', :default_width => 200)
+ *
+ *  window.get(:title)                 # => "Example"
+ *  window.get(:title, :default_width) # => ["Example", 200]
+ *
+ * @since  2026-10-19
+ * @param  [Array] names The names of the properties to retrieve.
+ * @raise  [ArgumentError] Raised when a property doesn't exist or can't be
+ *  read.
+ * @return [Mixed]
+ */
+static VALUE gtk3_object_get(int argc, VALUE *argv, VALUE self)
+{
+    int index;
+    VALUE values;
+    GObject *object;
+
+    if ( argc == 0 )
+    {
+        rb_raise(rb_eArgError, "wrong number of arguments(0 for 1..)");
+    }
+
+    Data_Get_Struct(self, GObject, object);
+
+    if ( argc == 1 )
+    {
+        return gtk3_property_get(object, argv[0]);
+    }
+
+    values = rb_ary_new2(argc);
+
+    for ( index = 0; index < argc; index++ )
+    {
+        rb_ary_push(values, gtk3_property_get(object, argv[index]));
+    }
+
+    return values;
+}
+
+/**
+ * Returns the value of a single property.
+ *
+ * @example
+ *  window = Gtk3::Window.new
+ *
+ *  window[:resizable] # => true
+ *
+ * @since  2026-10-19
+ * @param  [String|Symbol] name The name of the property.
+ * @return [Mixed]
+ */
+static VALUE gtk3_object_get_property(VALUE self, VALUE name)
+{
+    GObject *object;
+
+    Data_Get_Struct(self, GObject, object);
+
+    return gtk3_property_get(object, name);
+}
+
+/**
+ * Sets up the {Gtk3::Object} class, identity map and class registry.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_object()
+{
+    VALUE object_space;
+
+    gtk3_object_quark = g_quark_from_static_string("gtk3-rbobject");
+
+    gtk3_object_classes    = g_hash_table_new(g_direct_hash, g_direct_equal);
+    gtk3_object_gtypes     = g_hash_table_new(g_direct_hash, g_direct_equal);
+    gtk3_object_type_names = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    gtk3_object_pending_unrefs = g_ptr_array_new();
+
+    gtk3_id_aref = rb_intern("[]");
+    gtk3_id_aset = rb_intern("[]=");
+
+    object_space = rb_const_get(rb_cObject, rb_intern("ObjectSpace"));
+
+    /* ObjectSpace::WeakMap is available as of Ruby 2.0. */
+    if ( rb_const_defined_at(object_space, rb_intern("WeakMap")) )
+    {
+        gtk3_object_live_wrappers = rb_class_new_instance(
+            0,
+            NULL,
+            rb_const_get_at(object_space, rb_intern("WeakMap"))
+        );
+    }
+
+    rb_global_variable(&gtk3_object_live_wrappers);
+
+    gtk3_cObject = rb_define_class_under(gtk3_mGtk3, "Object", rb_cObject);
+
+    gtk3_object_register_class(G_TYPE_OBJECT, gtk3_cObject);
+
+    rb_undef_alloc_func(gtk3_cObject);
+
+    rb_define_method(gtk3_cObject, "set", gtk3_object_set, 1);
+    rb_define_method(gtk3_cObject, "get", gtk3_object_get, -1);
+    rb_define_method(gtk3_cObject, "[]", gtk3_object_get_property, 1);
+}
@@ -0,0 +1,33 @@
+#ifndef GTK3_OBJECT
+#define GTK3_OBJECT
+
+#include "gtk3.h"
+
+/**
+ * Structure that links a GObject to its Ruby object. It's stored as qdata on
+ * the GObject and has the following members:
+ *
+ * * self: the Ruby object.
+ * * wrappers: the amount of Ruby objects that hold a reference to the
+ *   GObject.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RWrapper
+{
+    VALUE self;
+    guint wrappers;
+} RWrapper;
+
+extern VALUE gtk3_cObject;
+
+extern VALUE gtk3_object_wrap(VALUE klass, gpointer object, gboolean owned);
+extern gpointer gtk3_object_unwrap(VALUE rbobject, GType type);
+extern void gtk3_object_register_class(GType type, VALUE klass);
+extern VALUE gtk3_object_class(GType type);
+extern GType gtk3_object_gtype(VALUE klass);
+extern GType gtk3_object_lookup_gtype(VALUE name);
+
+extern void Init_gtk3_object();
+
+#endif
@@ -0,0 +1,159 @@
+#include "pixbuf.h"
+
+/**
+ * Document-class: Gtk3::Pixbuf
+ *
+ * {Gtk3::Pixbuf} contains image data, such as icons loaded from files or
+ * resource bundles.
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cPixbuf;
+
+/**
+ * Wraps a newly loaded pixbuf or raises the error that occurred.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] class The class of the Ruby object.
+ * @param  [GdkPixbuf *] pixbuf The loaded pixbuf or NULL.
+ * @param  [GError *] error The error to raise if the pixbuf is NULL.
+ * @return [Gtk3::Pixbuf]
+ */
+static VALUE gtk3_pixbuf_wrap(VALUE class, GdkPixbuf *pixbuf, GError *error)
+{
+    VALUE rb_pixbuf;
+
+    if ( !pixbuf )
+    {
+        gtk3_error_raise(error);
+    }
+
+    rb_pixbuf = gtk3_object_wrap(class, pixbuf, TRUE);
+
+    rb_obj_call_init(rb_pixbuf, 0, NULL);
+
+    return rb_pixbuf;
+}
+
+/* Class methods */
+
+/**
+ * Loads an image from a file. Paths starting with `resource://` are loaded
+ * from the registered resource bundles.
+ *
+ * @example
+ *  icon = Gtk3::Pixbuf.new_from_file('resource:///com/example/app/icon.png')
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the image.
+ * @raise  [IOError] Raised when the image couldn't be read.
+ * @raise  [Gtk3::Error] Raised when the image couldn't be decoded.
+ * @return [Gtk3::Pixbuf]
+ */
+static VALUE gtk3_pixbuf_new_from_file(VALUE class, VALUE path)
+{
+    const gchar *resource;
+    GdkPixbuf *pixbuf;
+    GError *error = NULL;
+
+    Check_Type(path, T_STRING);
+
+    resource = gtk3_resource_path(StringValueCStr(path));
+
+    if ( resource )
+    {
+        pixbuf = gdk_pixbuf_new_from_resource(resource, &error);
+    }
+    else
+    {
+        pixbuf = gdk_pixbuf_new_from_file(StringValueCStr(path), &error);
+    }
+
+    return gtk3_pixbuf_wrap(class, pixbuf, error);
+}
+
+/**
+ * Loads an image from a registered resource bundle.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the resource.
+ * @raise  [IOError] Raised when the resource doesn't exist.
+ * @raise  [Gtk3::Error] Raised when the image couldn't be decoded.
+ * @return [Gtk3::Pixbuf]
+ */
+static VALUE gtk3_pixbuf_new_from_resource(VALUE class, VALUE path)
+{
+    const gchar *resource = gtk3_string_value_utf8(&path);
+    GError *error         = NULL;
+    GdkPixbuf *pixbuf;
+
+    if ( gtk3_resource_path(resource) )
+    {
+        resource = gtk3_resource_path(resource);
+    }
+
+    pixbuf = gdk_pixbuf_new_from_resource(resource, &error);
+
+    return gtk3_pixbuf_wrap(class, pixbuf, error);
+}
+
+/* Instance methods */
+
+/**
+ * Returns the width of the image in pixels.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_pixbuf_get_width(VALUE self)
+{
+    GdkPixbuf *pixbuf;
+
+    Data_Get_Struct(self, GdkPixbuf, pixbuf);
+
+    return INT2NUM(gdk_pixbuf_get_width(pixbuf));
+}
+
+/**
+ * Returns the height of the image in pixels.
+ *
+ * @since  2026-10-19
+ * @return [Fixnum]
+ */
+static VALUE gtk3_pixbuf_get_height(VALUE self)
+{
+    GdkPixbuf *pixbuf;
+
+    Data_Get_Struct(self, GdkPixbuf, pixbuf);
+
+    return INT2NUM(gdk_pixbuf_get_height(pixbuf));
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_pixbuf()
+{
+    gtk3_cPixbuf = rb_define_class_under(gtk3_mGtk3, "Pixbuf", gtk3_cObject);
+
+    gtk3_object_register_class(GDK_TYPE_PIXBUF, gtk3_cPixbuf);
+
+    rb_define_singleton_method(
+        gtk3_cPixbuf,
+        "new_from_file",
+        gtk3_pixbuf_new_from_file,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_cPixbuf,
+        "new_from_resource",
+        gtk3_pixbuf_new_from_resource,
+        1
+    );
+
+    rb_define_method(gtk3_cPixbuf, "width", gtk3_pixbuf_get_width, 0);
+    rb_define_method(gtk3_cPixbuf, "height", gtk3_pixbuf_get_height, 0);
+}
@@ -0,0 +1,10 @@
+#ifndef GTK3_PIXBUF
+#define GTK3_PIXBUF
+
+#include "gtk3.h"
+
+extern VALUE gtk3_cPixbuf;
+
+extern void Init_gtk3_pixbuf();
+
+#endif
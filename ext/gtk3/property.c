@@ -0,0 +1,399 @@
+#include "property.h"
+
+/**
+ * Hash table that maps a GType to a hash table containing the properties of
+ * the type. Each property table maps the IDs of both the canonical name (e.g.
+ * "default-width") and the Ruby style name (e.g. "default_width") of a
+ * property to an RProperty structure.
+ *
+ * Property tables are created the first time a type is used and are kept
+ * around for the lifetime of the process, just like the GObject classes they
+ * are based on.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_property_caches;
+
+/**
+ * Structure used for collecting a set of property names and values before
+ * passing them to GObject in a single call. This structure has the following
+ * members:
+ *
+ * * type: the type the properties belong to.
+ * * construct: when set to TRUE construct-only properties may be set.
+ * * object: the object to set the properties of, or the newly created object.
+ * * properties: the Ruby Hash containing the properties.
+ * * length: the amount of initialized values.
+ * * names: array of property names.
+ * * values: array of property values.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RPropertyList
+{
+    GType type;
+    gboolean construct;
+    GObject *object;
+    VALUE properties;
+    guint length;
+    const gchar **names;
+    GValue *values;
+} RPropertyList;
+
+/**
+ * Returns the property table of the given type, creating it if it doesn't
+ * exist yet.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type to get the property table for.
+ * @return [GHashTable *]
+ */
+static GHashTable *gtk3_property_cache(GType type)
+{
+    GHashTable *cache;
+    GObjectClass *object_class;
+    GParamSpec **pspecs;
+    guint n_pspecs;
+    guint index;
+    gchar *ruby_name;
+    RProperty *property;
+
+    cache = g_hash_table_lookup(gtk3_property_caches, GSIZE_TO_POINTER(type));
+
+    if ( cache != NULL )
+    {
+        return cache;
+    }
+
+    object_class = g_type_class_ref(type);
+    pspecs       = g_object_class_list_properties(object_class, &n_pspecs);
+    cache        = g_hash_table_new(g_direct_hash, g_direct_equal);
+
+    for ( index = 0; index < n_pspecs; index++ )
+    {
+        property            = g_new(RProperty, 1);
+        property->pspec     = pspecs[index];
+        property->converter = gtk3_value_converter(pspecs[index]->value_type);
+
+        ruby_name = g_strdelimit(g_strdup(pspecs[index]->name), "-", '_');
+
+        g_hash_table_insert(
+            cache,
+            GSIZE_TO_POINTER(rb_intern(pspecs[index]->name)),
+            property
+        );
+
+        g_hash_table_insert(
+            cache,
+            GSIZE_TO_POINTER(rb_intern(ruby_name)),
+            property
+        );
+
+        g_free(ruby_name);
+    }
+
+    g_free(pspecs);
+
+    g_hash_table_insert(gtk3_property_caches, GSIZE_TO_POINTER(type), cache);
+
+    return cache;
+}
+
+/**
+ * Looks up the property with the given name for the specified type.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type the property belongs to.
+ * @param  [VALUE] name A String or Symbol containing the property name.
+ * @raise  [TypeError] Raised when the name is not a String or Symbol or when
+ *  the type of the property is not supported.
+ * @raise  [ArgumentError] Raised when the property does not exist.
+ * @return [RProperty *]
+ */
+RProperty *gtk3_property_lookup(GType type, VALUE name)
+{
+    ID name_id;
+    RProperty *property;
+
+    if ( TYPE(name) == T_SYMBOL )
+    {
+        name_id = SYM2ID(name);
+    }
+    else if ( TYPE(name) == T_STRING )
+    {
+        name_id = rb_intern_str(name);
+    }
+    else
+    {
+        rb_raise(
+            rb_eTypeError,
+            "expected a String or Symbol as the property name"
+        );
+    }
+
+    property = g_hash_table_lookup(
+        gtk3_property_cache(type),
+        GSIZE_TO_POINTER(name_id)
+    );
+
+    if ( property == NULL )
+    {
+        rb_raise(
+            rb_eArgError,
+            "unknown property %s for %s",
+            rb_id2name(name_id),
+            g_type_name(type)
+        );
+    }
+
+    if ( property->converter == NULL )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "unsupported type %s for property %s",
+            g_type_name(property->pspec->value_type),
+            property->pspec->name
+        );
+    }
+
+    return property;
+}
+
+/**
+ * Converts a single key/value pair of a property Hash and adds it to an
+ * RPropertyList.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] name The name of the property.
+ * @param  [VALUE] value The value of the property.
+ * @param  [VALUE] data Pointer to the RPropertyList.
+ * @return [int]
+ */
+static int gtk3_property_list_add(VALUE name, VALUE value, VALUE data)
+{
+    GValue *gvalue;
+    GParamFlags flags;
+    RProperty *property;
+    RPropertyList *list = (RPropertyList *) data;
+
+    property = gtk3_property_lookup(list->type, name);
+    flags    = property->pspec->flags;
+
+    if ( !(flags & G_PARAM_WRITABLE)
+    || (!list->construct && (flags & G_PARAM_CONSTRUCT_ONLY)) )
+    {
+        rb_raise(
+            rb_eArgError,
+            "property %s is not writable",
+            property->pspec->name
+        );
+    }
+
+    gvalue = &list->values[list->length];
+
+    g_value_init(gvalue, property->pspec->value_type);
+
+    /*
+    The value is counted before converting it so that it's unset even if the
+    conversion raises an error.
+    */
+    list->names[list->length] = property->pspec->name;
+    list->length++;
+
+    property->converter->to_gvalue(value, gvalue);
+
+    return ST_CONTINUE;
+}
+
+/**
+ * Converts all the properties of an RPropertyList and sets them in one go.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Pointer to the RPropertyList.
+ * @return [VALUE]
+ */
+static VALUE gtk3_property_list_set(VALUE data)
+{
+    RPropertyList *list = (RPropertyList *) data;
+
+    rb_hash_foreach(list->properties, gtk3_property_list_add, data);
+
+    g_object_setv(list->object, list->length, list->names, list->values);
+
+    return Qnil;
+}
+
+/**
+ * Converts all the properties of an RPropertyList and creates a new object
+ * using them.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Pointer to the RPropertyList.
+ * @return [VALUE]
+ */
+static VALUE gtk3_property_list_construct(VALUE data)
+{
+    RPropertyList *list = (RPropertyList *) data;
+
+    rb_hash_foreach(list->properties, gtk3_property_list_add, data);
+
+    list->object = g_object_new_with_properties(
+        list->type,
+        list->length,
+        list->names,
+        list->values
+    );
+
+    return Qnil;
+}
+
+/**
+ * Unsets the values of an RPropertyList and frees the allocated memory.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data Pointer to the RPropertyList.
+ * @return [VALUE]
+ */
+static VALUE gtk3_property_list_free(VALUE data)
+{
+    guint index;
+    RPropertyList *list = (RPropertyList *) data;
+
+    for ( index = 0; index < list->length; index++ )
+    {
+        g_value_unset(&list->values[index]);
+    }
+
+    g_free(list->names);
+    g_free(list->values);
+
+    return Qnil;
+}
+
+/**
+ * Prepares an RPropertyList for the properties in the given Hash.
+ *
+ * @since 2026-10-19
+ * @param [RPropertyList *] list The list to prepare.
+ * @param [GType] type The type the properties belong to.
+ * @param [VALUE] properties A Hash containing the property names and values.
+ */
+static void gtk3_property_list_init(
+    RPropertyList *list,
+    GType type,
+    VALUE properties
+)
+{
+    guint size;
+
+    Check_Type(properties, T_HASH);
+
+    size = (guint) RHASH_SIZE(properties);
+
+    list->type       = type;
+    list->construct  = FALSE;
+    list->object     = NULL;
+    list->properties = properties;
+    list->length     = 0;
+    list->names      = g_new(const gchar *, size);
+    list->values     = g_new0(GValue, size);
+}
+
+/**
+ * Sets all the properties in the given Hash using a single call to
+ * `g_object_setv()`. This results in a single "notify" emission per property
+ * regardless of the amount of properties that are set.
+ *
+ * @since 2026-10-19
+ * @param [GObject *] object The object to set the properties of.
+ * @param [VALUE] properties A Hash containing the property names and values.
+ */
+void gtk3_property_set_many(GObject *object, VALUE properties)
+{
+    RPropertyList list;
+
+    gtk3_property_list_init(&list, G_OBJECT_TYPE(object), properties);
+
+    list.object = object;
+
+    rb_ensure(
+        gtk3_property_list_set,
+        (VALUE) &list,
+        gtk3_property_list_free,
+        (VALUE) &list
+    );
+}
+
+/**
+ * Creates a new object of the given type using a single call to
+ * `g_object_new_with_properties()`. Unlike {gtk3_property_set_many} this
+ * function also allows construct-only properties to be set.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type of the object to create.
+ * @param  [VALUE] properties A Hash containing the property names and values.
+ * @return [GObject *]
+ */
+GObject *gtk3_property_new_object(GType type, VALUE properties)
+{
+    RPropertyList list;
+
+    gtk3_property_list_init(&list, type, properties);
+
+    list.construct = TRUE;
+
+    rb_ensure(
+        gtk3_property_list_construct,
+        (VALUE) &list,
+        gtk3_property_list_free,
+        (VALUE) &list
+    );
+
+    return list.object;
+}
+
+/**
+ * Returns the value of a single property as a Ruby value.
+ *
+ * @since  2026-10-19
+ * @param  [GObject *] object The object to get the property from.
+ * @param  [VALUE] name The name of the property.
+ * @raise  [ArgumentError] Raised when the property can't be read.
+ * @return [VALUE]
+ */
+VALUE gtk3_property_get(GObject *object, VALUE name)
+{
+    VALUE rbvalue;
+    GValue gvalue = G_VALUE_INIT;
+    RProperty *property;
+
+    property = gtk3_property_lookup(G_OBJECT_TYPE(object), name);
+
+    if ( !(property->pspec->flags & G_PARAM_READABLE) )
+    {
+        rb_raise(
+            rb_eArgError,
+            "property %s is not readable",
+            property->pspec->name
+        );
+    }
+
+    g_value_init(&gvalue, property->pspec->value_type);
+    g_object_get_property(object, property->pspec->name, &gvalue);
+
+    rbvalue = property->converter->to_rbvalue(&gvalue);
+
+    g_value_unset(&gvalue);
+
+    return rbvalue;
+}
+
+/**
+ * Sets up the property cache.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_property()
+{
+    gtk3_property_caches = g_hash_table_new(g_direct_hash, g_direct_equal);
+}
@@ -0,0 +1,29 @@
+#ifndef GTK3_PROPERTY
+#define GTK3_PROPERTY
+
+#include "gtk3.h"
+
+/**
+ * Structure containing the cached details of a single GObject property. This
+ * structure has the following members:
+ *
+ * * pspec: the parameter specification of the property.
+ * * converter: the converter to use for the values of the property, or `NULL`
+ *   if the value type is not supported.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RProperty
+{
+    GParamSpec *pspec;
+    const RValueConverter *converter;
+} RProperty;
+
+extern RProperty *gtk3_property_lookup(GType type, VALUE name);
+extern void gtk3_property_set_many(GObject *object, VALUE properties);
+extern VALUE gtk3_property_get(GObject *object, VALUE name);
+extern GObject *gtk3_property_new_object(GType type, VALUE properties);
+
+extern void Init_gtk3_property();
+
+#endif
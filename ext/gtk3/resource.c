@@ -0,0 +1,376 @@
+#include "resource.h"
+
+/**
+ * The prefix of URIs that refer to registered resources.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_RESOURCE_SCHEME "resource://"
+
+/**
+ * Document-class: Gtk3::Resource
+ *
+ * {Gtk3::Resource} wraps a compiled resource bundle as produced by
+ * `glib-compile-resources`, making it cheap to ship UI definitions, style
+ * sheets and icons in a single file. Bundles loaded from files are memory
+ * mapped and builder, style sheet and pixbuf loads of `resource://` URIs read
+ * their data straight from the bundle. {Gtk3::Resource#lookup} copies the
+ * data of a resource into a Ruby String.
+ *
+ * Registered bundles can be used by {Gtk3::Builder} and {Gtk3::Pixbuf} using
+ * `resource://` URIs.
+ *
+ * @example
+ *  Gtk3::Resource.load('app.gresource').register
+ *
+ *  Gtk3::Builder.new.add_from_file('resource:///com/example/app/main.ui')
+ *
+ * @since 2026-10-19
+ */
+VALUE gtk3_cResource;
+
+/* Helper methods */
+
+/**
+ * Returns the resource path of a `resource://` URI, or NULL if the URI
+ * doesn't use the resource scheme. The returned path points into the URI.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] uri The URI or file path.
+ * @return [const gchar *]
+ */
+const gchar *gtk3_resource_path(const gchar *uri)
+{
+    if ( !g_str_has_prefix(uri, GTK3_RESOURCE_SCHEME) )
+    {
+        return NULL;
+    }
+
+    return uri + strlen(GTK3_RESOURCE_SCHEME);
+}
+
+/**
+ * Releases the GResource of a Ruby object.
+ *
+ * @since 2026-10-19
+ * @param [void *] data The GResource to release.
+ */
+static void gtk3_resource_free(void *data)
+{
+    g_resource_unref((GResource *) data);
+}
+
+/**
+ * Wraps a GResource in a Ruby object, taking over the caller's reference.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] class The class of the Ruby object.
+ * @param  [GResource *] resource The resource to wrap.
+ * @return [VALUE]
+ */
+static VALUE gtk3_resource_wrap(VALUE class, GResource *resource)
+{
+    VALUE rb_resource = Data_Wrap_Struct(
+        class,
+        NULL,
+        gtk3_resource_free,
+        resource
+    );
+
+    rb_obj_call_init(rb_resource, 0, NULL);
+
+    return rb_resource;
+}
+
+/**
+ * Returns the path of a resource, accepting both plain paths and
+ * `resource://` URIs.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE *] path The path or URI.
+ * @return [const gchar *]
+ */
+static const gchar *gtk3_resource_path_value(VALUE *path)
+{
+    const gchar *uri      = gtk3_string_value_utf8(path);
+    const gchar *resource = gtk3_resource_path(uri);
+
+    return resource ? resource : uri;
+}
+
+/* Class methods */
+
+/**
+ * Loads a compiled resource bundle from a file. The file is memory mapped
+ * instead of being read.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the bundle.
+ * @raise  [IOError] Raised when the bundle couldn't be loaded.
+ * @return [Gtk3::Resource]
+ */
+static VALUE gtk3_resource_load(VALUE class, VALUE path)
+{
+    GResource *resource;
+    GError *error = NULL;
+
+    Check_Type(path, T_STRING);
+
+    resource = g_resource_load(StringValueCStr(path), &error);
+
+    if ( !resource )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return gtk3_resource_wrap(class, resource);
+}
+
+/**
+ * Creates a resource bundle from a String containing a compiled bundle. The
+ * data of frozen Strings is used directly instead of being copied.
+ *
+ * @example
+ *  bundle = File.binread('app.gresource').freeze
+ *
+ *  Gtk3::Resource.from_data(bundle).register
+ *
+ * @since  2026-10-19
+ * @param  [String] data The compiled bundle.
+ * @raise  [IOError] Raised when the data isn't a valid bundle.
+ * @return [Gtk3::Resource]
+ */
+static VALUE gtk3_resource_from_data(VALUE class, VALUE data)
+{
+    GBytes *bytes;
+    GResource *resource;
+    GError *error = NULL;
+
+    bytes    = gtk3_rbstring_to_bytes(data);
+    resource = g_resource_new_from_data(bytes, &error);
+
+    g_bytes_unref(bytes);
+
+    if ( !resource )
+    {
+        gtk3_error_raise(error);
+    }
+
+    return gtk3_resource_wrap(class, resource);
+}
+
+/**
+ * Returns the data of a resource in any of the registered bundles.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path or `resource://` URI of the resource.
+ * @raise  [IOError] Raised when the resource doesn't exist.
+ * @return [String]
+ */
+static VALUE gtk3_resource_lookup_registered(VALUE class, VALUE path)
+{
+    GBytes *bytes;
+    VALUE data;
+    GError *error = NULL;
+
+    bytes = g_resources_lookup_data(
+        gtk3_resource_path_value(&path),
+        G_RESOURCE_LOOKUP_FLAGS_NONE,
+        &error
+    );
+
+    if ( !bytes )
+    {
+        gtk3_error_raise(error);
+    }
+
+    data = gtk3_bytes_to_rbstring(bytes);
+
+    g_bytes_unref(bytes);
+
+    return data;
+}
+
+/* Instance methods */
+
+/**
+ * Registers the bundle so that its resources can be used by GTK and
+ * `resource://` URIs.
+ *
+ * @since  2026-10-19
+ * @return [Gtk3::Resource]
+ */
+static VALUE gtk3_resource_register(VALUE self)
+{
+    GResource *resource;
+
+    Data_Get_Struct(self, GResource, resource);
+
+    g_resources_register(resource);
+
+    return self;
+}
+
+/**
+ * Unregisters the bundle.
+ *
+ * @since  2026-10-19
+ * @return [Gtk3::Resource]
+ */
+static VALUE gtk3_resource_unregister(VALUE self)
+{
+    GResource *resource;
+
+    Data_Get_Struct(self, GResource, resource);
+
+    g_resources_unregister(resource);
+
+    return self;
+}
+
+/**
+ * Returns a copy of the data of a resource in the bundle as a frozen String.
+ * Use `resource://` URIs to let GTK read resources without copying them.
+ *
+ * @example
+ *  css = bundle.lookup('/com/example/app/style.css')
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path or `resource://` URI of the resource.
+ * @raise  [IOError] Raised when the resource doesn't exist.
+ * @return [String]
+ */
+static VALUE gtk3_resource_lookup(VALUE self, VALUE path)
+{
+    GResource *resource;
+    GBytes *bytes;
+    VALUE data;
+    GError *error = NULL;
+
+    Data_Get_Struct(self, GResource, resource);
+
+    bytes = g_resource_lookup_data(
+        resource,
+        gtk3_resource_path_value(&path),
+        G_RESOURCE_LOOKUP_FLAGS_NONE,
+        &error
+    );
+
+    if ( !bytes )
+    {
+        gtk3_error_raise(error);
+    }
+
+    data = gtk3_bytes_to_rbstring(bytes);
+
+    g_bytes_unref(bytes);
+
+    return data;
+}
+
+/**
+ * Returns `true` if the bundle contains the given resource or directory.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path or `resource://` URI of the resource.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_resource_exists(VALUE self, VALUE path)
+{
+    GResource *resource;
+
+    Data_Get_Struct(self, GResource, resource);
+
+    return g_resource_get_info(
+        resource,
+        gtk3_resource_path_value(&path),
+        G_RESOURCE_LOOKUP_FLAGS_NONE,
+        NULL,
+        NULL,
+        NULL
+    ) ? Qtrue : Qfalse;
+}
+
+/**
+ * Returns the names of the entries in a directory of the bundle. The names
+ * of directories end with a slash.
+ *
+ * @since  2026-10-19
+ * @param  [String] path The path of the directory.
+ * @raise  [IOError] Raised when the directory doesn't exist.
+ * @return [Array]
+ */
+static VALUE gtk3_resource_children(VALUE self, VALUE path)
+{
+    GResource *resource;
+    gchar **children;
+    gchar **child;
+    VALUE rb_children;
+    GError *error = NULL;
+
+    Data_Get_Struct(self, GResource, resource);
+
+    children = g_resource_enumerate_children(
+        resource,
+        gtk3_resource_path_value(&path),
+        G_RESOURCE_LOOKUP_FLAGS_NONE,
+        &error
+    );
+
+    if ( !children )
+    {
+        gtk3_error_raise(error);
+    }
+
+    rb_children = rb_ary_new();
+
+    for ( child = children; *child != NULL; child++ )
+    {
+        rb_ary_push(rb_children, gtk3_utf8_new(*child));
+    }
+
+    g_strfreev(children);
+
+    return rb_children;
+}
+
+/**
+ * Initializes the class.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_resource()
+{
+    gtk3_cResource = rb_define_class_under(gtk3_mGtk3, "Resource", rb_cObject);
+
+    rb_undef_alloc_func(gtk3_cResource);
+
+    rb_define_singleton_method(gtk3_cResource, "load", gtk3_resource_load, 1);
+
+    rb_define_singleton_method(
+        gtk3_cResource,
+        "from_data",
+        gtk3_resource_from_data,
+        1
+    );
+
+    rb_define_singleton_method(
+        gtk3_cResource,
+        "lookup",
+        gtk3_resource_lookup_registered,
+        1
+    );
+
+    rb_define_method(gtk3_cResource, "register", gtk3_resource_register, 0);
+
+    rb_define_method(
+        gtk3_cResource,
+        "unregister",
+        gtk3_resource_unregister,
+        0
+    );
+
+    rb_define_method(gtk3_cResource, "lookup", gtk3_resource_lookup, 1);
+    rb_define_method(gtk3_cResource, "exists?", gtk3_resource_exists, 1);
+    rb_define_method(gtk3_cResource, "children", gtk3_resource_children, 1);
+}
@@ -0,0 +1,12 @@
+#ifndef GTK3_RESOURCE
+#define GTK3_RESOURCE
+
+#include "gtk3.h"
+
+extern VALUE gtk3_cResource;
+
+extern const gchar *gtk3_resource_path(const gchar *uri);
+
+extern void Init_gtk3_resource();
+
+#endif
@@ -39,45 +39,57 @@ VALUE gtk3_rboolean_to_gboolean(VALUE rbool)
 }
 
 /**
- * Converts a Ruby value to a GValue.
- *
- * TODO: currently the amount of types this function can handle is rather
- * limited. Based on whether or not it's needed this function should be capable
- * of handling more types (e.g. hashes).
+ * Converts a Ruby value to a GValue. The GValue must be initialized as its type
+ * determines how the Ruby value is converted.
  *
  * @since 2012-06-03
  * @param [VALUE] rbvalue The Ruby value to convert.
  * @param [GValue] gvalue A GValue object to store the converted value in.
+ * @raise [TypeError] Raised when the type of the GValue is not supported or
+ *  when the Ruby value is of the wrong type.
  */
 void gtk3_rbvalue_to_gvalue(VALUE rbvalue, GValue *gvalue)
 {
-    switch ( TYPE(rbvalue) )
+    const RValueConverter *converter;
+
+    converter = gtk3_value_converter(G_VALUE_TYPE(gvalue));
+
+    if ( converter == NULL )
     {
-        case T_FLOAT:
-            g_value_set_double(gvalue, NUM2DBL(rbvalue));
-            break;
+        rb_raise(
+            rb_eTypeError,
+            "unsupported value type %s",
+            G_VALUE_TYPE_NAME(gvalue)
+        );
+    }
 
-        case T_STRING:
-        case T_SYMBOL:
-            rbvalue = rb_funcall(rbvalue, gtk3_id_to_s, 0);
-            g_value_set_string(gvalue, StringValuePtr(rbvalue));
-            break;
+    converter->to_gvalue(rbvalue, gvalue);
+}
 
-        case T_FIXNUM:
-            g_value_set_int(gvalue, NUM2INT(rbvalue));
-            break;
+/**
+ * Converts a GValue to a Ruby value.
+ *
+ * @since  2026-10-19
+ * @param  [GValue] gvalue The GValue to convert.
+ * @raise  [TypeError] Raised when the type of the GValue is not supported.
+ * @return [VALUE]
+ */
+VALUE gtk3_gvalue_to_rbvalue(const GValue *gvalue)
+{
+    const RValueConverter *converter;
 
-        case T_BIGNUM:
-            g_value_set_int64(gvalue, NUM2LONG(rbvalue));
-            break;
+    converter = gtk3_value_converter(G_VALUE_TYPE(gvalue));
 
-        case T_TRUE:
-            g_value_set_boolean(gvalue, TRUE);
-            break;
-        case T_FALSE:
-            g_value_set_boolean(gvalue, FALSE);
-            break;
+    if ( converter == NULL )
+    {
+        rb_raise(
+            rb_eTypeError,
+            "unsupported value type %s",
+            G_VALUE_TYPE_NAME(gvalue)
+        );
     }
+
+    return converter->to_rbvalue(gvalue);
 }
 
 /**
@@ -135,3 +147,643 @@ char *gtk3_get_rbclass(VALUE object)
 
    return StringValuePtr(object_class);
 }
+
+/**
+ * Returns the index of a fundamental GType in the converter table.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_FUNDAMENTAL_INDEX(type) \
+    (G_TYPE_FUNDAMENTAL(type) >> G_TYPE_FUNDAMENTAL_SHIFT)
+
+/**
+ * Table of value converters, indexed by the fundamental GType of a value.
+ * Entries without a `to_gvalue` function are not supported.
+ *
+ * @since 2026-10-19
+ */
+static RValueConverter gtk3_value_converters[
+    (G_TYPE_FUNDAMENTAL_MAX >> G_TYPE_FUNDAMENTAL_SHIFT) + 1
+];
+
+/* Converter functions */
+
+static void gtk3_boolean_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_boolean(rbvalue);
+
+    g_value_set_boolean(gvalue, gtk3_rboolean_to_gboolean(rbvalue));
+}
+
+static VALUE gtk3_boolean_to_rbvalue(const GValue *gvalue)
+{
+    return gtk3_gboolean_to_rboolean(g_value_get_boolean(gvalue));
+}
+
+static void gtk3_char_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_schar(gvalue, (gint8) NUM2INT(rbvalue));
+}
+
+static VALUE gtk3_char_to_rbvalue(const GValue *gvalue)
+{
+    return INT2FIX(g_value_get_schar(gvalue));
+}
+
+static void gtk3_uchar_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_uchar(gvalue, (guchar) NUM2UINT(rbvalue));
+}
+
+static VALUE gtk3_uchar_to_rbvalue(const GValue *gvalue)
+{
+    return INT2FIX(g_value_get_uchar(gvalue));
+}
+
+static void gtk3_int_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_int(gvalue, NUM2INT(rbvalue));
+}
+
+static VALUE gtk3_int_to_rbvalue(const GValue *gvalue)
+{
+    return INT2NUM(g_value_get_int(gvalue));
+}
+
+static void gtk3_uint_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_uint(gvalue, NUM2UINT(rbvalue));
+}
+
+static VALUE gtk3_uint_to_rbvalue(const GValue *gvalue)
+{
+    return UINT2NUM(g_value_get_uint(gvalue));
+}
+
+static void gtk3_long_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_long(gvalue, NUM2LONG(rbvalue));
+}
+
+static VALUE gtk3_long_to_rbvalue(const GValue *gvalue)
+{
+    return LONG2NUM(g_value_get_long(gvalue));
+}
+
+static void gtk3_ulong_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_ulong(gvalue, NUM2ULONG(rbvalue));
+}
+
+static VALUE gtk3_ulong_to_rbvalue(const GValue *gvalue)
+{
+    return ULONG2NUM(g_value_get_ulong(gvalue));
+}
+
+static void gtk3_int64_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_int64(gvalue, NUM2LL(rbvalue));
+}
+
+static VALUE gtk3_int64_to_rbvalue(const GValue *gvalue)
+{
+    return LL2NUM(g_value_get_int64(gvalue));
+}
+
+static void gtk3_uint64_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    gtk3_check_number(rbvalue);
+
+    g_value_set_uint64(gvalue, NUM2ULL(rbvalue));
+}
+
+static VALUE gtk3_uint64_to_rbvalue(const GValue *gvalue)
+{
+    return ULL2NUM(g_value_get_uint64(gvalue));
+}
+
+/**
+ * Returns the class of a type, creating it if needed. Classes of static types
+ * are never finalized, thus the reference is never dropped.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type to get the class of.
+ * @return [gpointer]
+ */
+static gpointer gtk3_type_class(GType type)
+{
+    gpointer type_class = g_type_class_peek(type);
+
+    if ( type_class == NULL )
+    {
+        type_class = g_type_class_ref(type);
+    }
+
+    return type_class;
+}
+
+/**
+ * Copies the name of an enum or flags value into a buffer, converting it to
+ * the form used for value nicks (e.g. `:mouse_always` becomes
+ * "mouse-always"). Symbols are read without allocating any Ruby objects.
+ * Names that don't fit in the buffer can't be the name of a value.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] name A String or Symbol containing the name.
+ * @param  [GType] type The enum or flags type the name belongs to.
+ * @param  [char *] buffer The buffer to copy the nick into.
+ * @param  [size_t] size The size of the buffer.
+ * @raise  [ArgumentError] Raised when the name doesn't fit in the buffer.
+ * @return [const char *]
+ */
+static const char *gtk3_value_nick(
+    VALUE name,
+    GType type,
+    char *buffer,
+    size_t size
+)
+{
+    size_t index;
+    const char *source;
+
+    if ( TYPE(name) == T_SYMBOL )
+    {
+        source = rb_id2name(SYM2ID(name));
+    }
+    else
+    {
+        source = StringValueCStr(name);
+    }
+
+    if ( strlen(source) >= size )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid %s value %s",
+            g_type_name(type),
+            source
+        );
+    }
+
+    for ( index = 0; source[index] != '\0'; index++ )
+    {
+        if ( source[index] == '_' )
+        {
+            buffer[index] = '-';
+        }
+        else
+        {
+            buffer[index] = g_ascii_tolower(source[index]);
+        }
+    }
+
+    buffer[index] = '\0';
+
+    return buffer;
+}
+
+static void gtk3_enum_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    char nick[64];
+    GEnumClass *enum_class;
+    GEnumValue *enum_value;
+
+    if ( TYPE(rbvalue) != T_SYMBOL && TYPE(rbvalue) != T_STRING )
+    {
+        gtk3_check_number(rbvalue);
+
+        g_value_set_enum(gvalue, NUM2INT(rbvalue));
+
+        return;
+    }
+
+    gtk3_value_nick(rbvalue, G_VALUE_TYPE(gvalue), nick, sizeof(nick));
+
+    enum_class = gtk3_type_class(G_VALUE_TYPE(gvalue));
+    enum_value = g_enum_get_value_by_nick(enum_class, nick);
+
+    if ( enum_value == NULL )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid %s value %s",
+            G_VALUE_TYPE_NAME(gvalue),
+            nick
+        );
+    }
+
+    g_value_set_enum(gvalue, enum_value->value);
+}
+
+static VALUE gtk3_enum_to_rbvalue(const GValue *gvalue)
+{
+    return INT2NUM(g_value_get_enum(gvalue));
+}
+
+/**
+ * Converts a single flag to its numeric value. The flag can be a number or
+ * the name of a flag.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] rbvalue The flag to convert.
+ * @param  [GFlagsClass *] flags_class The class of the flags type.
+ * @raise  [ArgumentError] Raised when the flag does not exist.
+ * @return [guint]
+ */
+static guint gtk3_flag_value(VALUE rbvalue, GFlagsClass *flags_class)
+{
+    char nick[64];
+    GFlagsValue *flags_value;
+
+    if ( TYPE(rbvalue) != T_SYMBOL && TYPE(rbvalue) != T_STRING )
+    {
+        gtk3_check_number(rbvalue);
+
+        return NUM2UINT(rbvalue);
+    }
+
+    gtk3_value_nick(
+        rbvalue,
+        G_FLAGS_CLASS_TYPE(flags_class),
+        nick,
+        sizeof(nick)
+    );
+
+    flags_value = g_flags_get_value_by_nick(flags_class, nick);
+
+    if ( flags_value == NULL )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid %s value %s",
+            G_FLAGS_CLASS_TYPE_NAME(flags_class),
+            nick
+        );
+    }
+
+    return flags_value->value;
+}
+
+static void gtk3_flags_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    long index;
+    guint flags = 0;
+    GFlagsClass *flags_class;
+
+    flags_class = gtk3_type_class(G_VALUE_TYPE(gvalue));
+
+    if ( TYPE(rbvalue) == T_ARRAY )
+    {
+        for ( index = 0; index < RARRAY_LEN(rbvalue); index++ )
+        {
+            flags |= gtk3_flag_value(rb_ary_entry(rbvalue, index), flags_class);
+        }
+    }
+    else
+    {
+        flags = gtk3_flag_value(rbvalue, flags_class);
+    }
+
+    g_value_set_flags(gvalue, flags);
+}
+
+static VALUE gtk3_flags_to_rbvalue(const GValue *gvalue)
+{
+    return UINT2NUM(g_value_get_flags(gvalue));
+}
+
+static void gtk3_float_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    g_value_set_float(gvalue, (gfloat) NUM2DBL(rbvalue));
+}
+
+static VALUE gtk3_float_to_rbvalue(const GValue *gvalue)
+{
+    return rb_float_new(g_value_get_float(gvalue));
+}
+
+static void gtk3_double_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    g_value_set_double(gvalue, NUM2DBL(rbvalue));
+}
+
+static VALUE gtk3_double_to_rbvalue(const GValue *gvalue)
+{
+    return rb_float_new(g_value_get_double(gvalue));
+}
+
+static void gtk3_string_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    if ( NIL_P(rbvalue) )
+    {
+        g_value_set_string(gvalue, NULL);
+    }
+    else if ( TYPE(rbvalue) == T_SYMBOL )
+    {
+        g_value_set_string(gvalue, rb_id2name(SYM2ID(rbvalue)));
+    }
+    else
+    {
+        Check_Type(rbvalue, T_STRING);
+
+        g_value_set_string(gvalue, gtk3_string_value_utf8(&rbvalue));
+    }
+}
+
+static VALUE gtk3_string_to_rbvalue(const GValue *gvalue)
+{
+    return gtk3_utf8_new(g_value_get_string(gvalue));
+}
+
+static void gtk3_strv_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    long index;
+    long length;
+    VALUE string;
+    VALUE strings;
+    gchar **strv;
+
+    Check_Type(rbvalue, T_ARRAY);
+
+    length  = RARRAY_LEN(rbvalue);
+    strings = rb_ary_new2(length);
+
+    /* Convert all the values first so nothing leaks when raising an error. */
+    for ( index = 0; index < length; index++ )
+    {
+        string = rb_ary_entry(rbvalue, index);
+
+        gtk3_string_value_utf8(&string);
+
+        rb_ary_push(strings, string);
+    }
+
+    strv = g_new(gchar *, length + 1);
+
+    for ( index = 0; index < length; index++ )
+    {
+        strv[index] = g_strdup(RSTRING_PTR(rb_ary_entry(strings, index)));
+    }
+
+    strv[length] = NULL;
+
+    g_value_take_boxed(gvalue, strv);
+}
+
+static VALUE gtk3_strv_to_rbvalue(const GValue *gvalue)
+{
+    VALUE array;
+    gchar **strv = g_value_get_boxed(gvalue);
+
+    if ( strv == NULL )
+    {
+        return Qnil;
+    }
+
+    array = rb_ary_new2(g_strv_length(strv));
+
+    for ( ; *strv != NULL; strv++ )
+    {
+        rb_ary_push(array, gtk3_utf8_new(*strv));
+    }
+
+    return array;
+}
+
+static void gtk3_bytes_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    g_value_take_boxed(gvalue, gtk3_rbstring_to_bytes(rbvalue));
+}
+
+static VALUE gtk3_bytes_to_rbvalue(const GValue *gvalue)
+{
+    return gtk3_bytes_to_rbstring(g_value_get_boxed(gvalue));
+}
+
+static void gtk3_boxed_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    GType type = G_VALUE_TYPE(gvalue);
+
+    if ( NIL_P(rbvalue) )
+    {
+        g_value_set_boxed(gvalue, NULL);
+    }
+    else if ( type == G_TYPE_STRV )
+    {
+        gtk3_strv_to_gvalue(rbvalue, gvalue);
+    }
+    else if ( type == G_TYPE_BYTES )
+    {
+        gtk3_bytes_to_gvalue(rbvalue, gvalue);
+    }
+    else
+    {
+        g_value_set_boxed(gvalue, gtk3_boxed_unwrap(rbvalue, type));
+    }
+}
+
+static VALUE gtk3_boxed_to_rbvalue(const GValue *gvalue)
+{
+    GType type = G_VALUE_TYPE(gvalue);
+
+    if ( type == G_TYPE_STRV )
+    {
+        return gtk3_strv_to_rbvalue(gvalue);
+    }
+    else if ( type == G_TYPE_BYTES )
+    {
+        return gtk3_bytes_to_rbvalue(gvalue);
+    }
+    else
+    {
+        return gtk3_boxed_wrap(type, g_value_get_boxed(gvalue));
+    }
+}
+
+static void gtk3_object_to_gvalue(VALUE rbvalue, GValue *gvalue)
+{
+    if ( NIL_P(rbvalue) )
+    {
+        g_value_set_object(gvalue, NULL);
+    }
+    else
+    {
+        g_value_set_object(
+            gvalue,
+            gtk3_object_unwrap(rbvalue, G_VALUE_TYPE(gvalue))
+        );
+    }
+}
+
+static VALUE gtk3_object_to_rbvalue(const GValue *gvalue)
+{
+    return gtk3_object_wrap(Qnil, g_value_get_object(gvalue), FALSE);
+}
+
+/**
+ * Adds a converter for the given fundamental type to the converter table.
+ *
+ * @since 2026-10-19
+ * @param [GType] type The fundamental type.
+ * @param [gtk3_to_gvalue_func] to_gvalue Function for converting Ruby values.
+ * @param [gtk3_to_rbvalue_func] to_rbvalue Function for converting GValues.
+ */
+static void gtk3_register_value_converter(
+    GType type,
+    gtk3_to_gvalue_func to_gvalue,
+    gtk3_to_rbvalue_func to_rbvalue
+)
+{
+    RValueConverter *converter;
+
+    converter = &gtk3_value_converters[GTK3_FUNDAMENTAL_INDEX(type)];
+
+    converter->to_gvalue  = to_gvalue;
+    converter->to_rbvalue = to_rbvalue;
+}
+
+/**
+ * Returns the converter to use for values of the given GType. If the type is
+ * not supported `NULL` is returned instead.
+ *
+ * @since  2026-10-19
+ * @param  [GType] type The type of the values to convert.
+ * @return [const RValueConverter *]
+ */
+const RValueConverter *gtk3_value_converter(GType type)
+{
+    const RValueConverter *converter;
+
+    converter = &gtk3_value_converters[GTK3_FUNDAMENTAL_INDEX(type)];
+
+    if ( converter->to_gvalue == NULL )
+    {
+        return NULL;
+    }
+
+    return converter;
+}
+
+/**
+ * Sets up the converter table.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_type()
+{
+    gtk3_register_value_converter(
+        G_TYPE_BOOLEAN,
+        gtk3_boolean_to_gvalue,
+        gtk3_boolean_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_CHAR,
+        gtk3_char_to_gvalue,
+        gtk3_char_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_UCHAR,
+        gtk3_uchar_to_gvalue,
+        gtk3_uchar_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_INT,
+        gtk3_int_to_gvalue,
+        gtk3_int_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_UINT,
+        gtk3_uint_to_gvalue,
+        gtk3_uint_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_LONG,
+        gtk3_long_to_gvalue,
+        gtk3_long_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_ULONG,
+        gtk3_ulong_to_gvalue,
+        gtk3_ulong_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_INT64,
+        gtk3_int64_to_gvalue,
+        gtk3_int64_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_UINT64,
+        gtk3_uint64_to_gvalue,
+        gtk3_uint64_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_ENUM,
+        gtk3_enum_to_gvalue,
+        gtk3_enum_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_FLAGS,
+        gtk3_flags_to_gvalue,
+        gtk3_flags_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_FLOAT,
+        gtk3_float_to_gvalue,
+        gtk3_float_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_DOUBLE,
+        gtk3_double_to_gvalue,
+        gtk3_double_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_STRING,
+        gtk3_string_to_gvalue,
+        gtk3_string_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_BOXED,
+        gtk3_boxed_to_gvalue,
+        gtk3_boxed_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_OBJECT,
+        gtk3_object_to_gvalue,
+        gtk3_object_to_rbvalue
+    );
+
+    gtk3_register_value_converter(
+        G_TYPE_INTERFACE,
+        gtk3_object_to_gvalue,
+        gtk3_object_to_rbvalue
+    );
+}
@@ -3,11 +3,44 @@
 
 #include "gtk3.h"
 
+/**
+ * Function that converts a Ruby value and stores it in an initialized GValue.
+ *
+ * @since 2026-10-19
+ */
+typedef void (*gtk3_to_gvalue_func)(VALUE rbvalue, GValue *gvalue);
+
+/**
+ * Function that converts the contents of a GValue to a Ruby value.
+ *
+ * @since 2026-10-19
+ */
+typedef VALUE (*gtk3_to_rbvalue_func)(const GValue *gvalue);
+
+/**
+ * Structure containing the functions used for converting values of a single
+ * fundamental GType. This structure has the following members:
+ *
+ * * to_gvalue: function that converts a Ruby value to a GValue.
+ * * to_rbvalue: function that converts a GValue to a Ruby value.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RValueConverter
+{
+    gtk3_to_gvalue_func to_gvalue;
+    gtk3_to_rbvalue_func to_rbvalue;
+} RValueConverter;
+
 extern VALUE gtk3_gboolean_to_rboolean(gboolean boolean);
 extern VALUE gtk3_rboolean_to_gboolean(VALUE rbool);
 extern void gtk3_check_number(VALUE number);
 extern void gtk3_check_boolean(VALUE val);
 extern void gtk3_rbvalue_to_gvalue(VALUE rbvalue, GValue *gvalue);
+extern VALUE gtk3_gvalue_to_rbvalue(const GValue *gvalue);
 extern char *gtk3_get_rbclass(VALUE object);
+extern const RValueConverter *gtk3_value_converter(GType type);
+
+extern void Init_gtk3_type();
 
 #endif
@@ -0,0 +1,334 @@
+#include "utf8.h"
+
+/**
+ * The maximum amount of bytes of string data to keep in the intern cache.
+ * When the cache is full the least recently used Strings are removed, Strings
+ * that are larger than the cache itself are never cached.
+ *
+ * @since 2026-10-19
+ */
+#define GTK3_UTF8_INTERN_LIMIT (256 * 1024)
+
+/**
+ * Structure containing a C string and the frozen Ruby String with the same
+ * contents.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RUtf8Interned
+{
+    gchar *string;
+    gsize size;
+    VALUE rbstring;
+    GList *link;
+} RUtf8Interned;
+
+/**
+ * Hash table that maps C strings to their RUtf8Interned. The Strings are
+ * marked by gtk3_utf8_interned_keeper.
+ *
+ * @since 2026-10-19
+ */
+static GHashTable *gtk3_utf8_interned;
+
+/**
+ * Queue of all the interned Strings, ordered from most to least recently
+ * used.
+ *
+ * @since 2026-10-19
+ */
+static GQueue gtk3_utf8_interned_order = G_QUEUE_INIT;
+
+/**
+ * The total size in bytes of the Strings in the intern cache.
+ *
+ * @since 2026-10-19
+ */
+static gsize gtk3_utf8_interned_size = 0;
+
+/**
+ * Hidden Ruby object that marks the Strings in gtk3_utf8_interned.
+ *
+ * @since 2026-10-19
+ */
+static VALUE gtk3_utf8_interned_keeper;
+
+/**
+ * The amount of lookups in the intern cache that returned an existing String.
+ *
+ * @since 2026-10-19
+ */
+static size_t gtk3_utf8_intern_hits = 0;
+
+/**
+ * The amount of lookups in the intern cache that created a new String.
+ *
+ * @since 2026-10-19
+ */
+static size_t gtk3_utf8_intern_misses = 0;
+
+/**
+ * Frees an entry of the intern cache.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The RUtf8Interned to free.
+ */
+static void gtk3_utf8_interned_free(gpointer data)
+{
+    RUtf8Interned *interned = (RUtf8Interned *) data;
+
+    g_free(interned->string);
+    g_free(interned);
+}
+
+/**
+ * Raises an ArgumentError for a String containing invalid byte sequences.
+ *
+ * @since 2026-10-19
+ * @param [rb_encoding *] encoding The encoding of the String.
+ */
+static void gtk3_utf8_raise_invalid(rb_encoding *encoding)
+{
+    rb_raise(
+        rb_eArgError,
+        "invalid byte sequence in %s",
+        rb_enc_name(encoding)
+    );
+}
+
+/**
+ * Returns a pointer to a NULL terminated, UTF-8 encoded version of a String.
+ *
+ * UTF-8 and US-ASCII Strings are only scanned once, after that Ruby caches
+ * the result in the String's coderange. Binary Strings are validated as
+ * UTF-8 and Strings using any other encoding are transcoded to UTF-8, in
+ * which case the variable the String was read from is updated to refer to the
+ * transcoded String. This keeps the new String alive for as long as the
+ * caller uses the returned pointer.
+ *
+ * An ArgumentError is raised for Strings that contain invalid byte sequences
+ * or NULL bytes so that GTK never has to deal with them.
+ *
+ * @example
+ *  gtk_window_set_title(window, gtk3_string_value_utf8(&title));
+ *
+ * @since  2026-10-19
+ * @param  [VALUE *] string Pointer to the String to convert.
+ * @return [const gchar *]
+ */
+const gchar *gtk3_string_value_utf8(VALUE *string)
+{
+    int coderange;
+    rb_encoding *encoding;
+
+    Check_Type(*string, T_STRING);
+
+    encoding = rb_enc_get(*string);
+
+    if ( encoding == rb_ascii8bit_encoding() )
+    {
+        if ( !g_utf8_validate(RSTRING_PTR(*string), RSTRING_LEN(*string), 0) )
+        {
+            gtk3_utf8_raise_invalid(rb_utf8_encoding());
+        }
+
+        return StringValueCStr(*string);
+    }
+
+    coderange = rb_enc_str_coderange(*string);
+
+    if ( coderange == ENC_CODERANGE_BROKEN )
+    {
+        gtk3_utf8_raise_invalid(encoding);
+    }
+
+    if ( coderange != ENC_CODERANGE_7BIT
+    && encoding != rb_utf8_encoding()
+    && encoding != rb_usascii_encoding() )
+    {
+        *string = rb_str_encode(
+            *string,
+            rb_enc_from_encoding(rb_utf8_encoding()),
+            0,
+            Qnil
+        );
+    }
+
+    return StringValueCStr(*string);
+}
+
+/**
+ * Returns a new UTF-8 encoded String for a string returned by GTK, or nil if
+ * the string is NULL.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] string The string to convert.
+ * @return [String|NilClass]
+ */
+VALUE gtk3_utf8_new(const gchar *string)
+{
+    if ( string == NULL )
+    {
+        return Qnil;
+    }
+
+    return rb_enc_str_new(string, strlen(string), rb_utf8_encoding());
+}
+
+/**
+ * Returns a frozen UTF-8 String for a string returned by GTK. As long as the
+ * contents of the C string don't change the same String is returned, saving
+ * an allocation for getters that are called often and rarely change.
+ *
+ * @since  2026-10-19
+ * @param  [const gchar *] string The string to convert.
+ * @return [String|NilClass]
+ */
+VALUE gtk3_utf8_intern(const gchar *string)
+{
+    gsize size;
+    VALUE rbstring;
+    RUtf8Interned *interned;
+
+    if ( string == NULL )
+    {
+        return Qnil;
+    }
+
+    interned = g_hash_table_lookup(gtk3_utf8_interned, string);
+
+    if ( interned != NULL )
+    {
+        gtk3_utf8_intern_hits++;
+
+        g_queue_unlink(&gtk3_utf8_interned_order, interned->link);
+        g_queue_push_head_link(&gtk3_utf8_interned_order, interned->link);
+
+        return interned->rbstring;
+    }
+
+    gtk3_utf8_intern_misses++;
+
+    size     = strlen(string);
+    rbstring = rb_obj_freeze(
+        rb_enc_str_new(string, size, rb_utf8_encoding())
+    );
+
+    if ( size > GTK3_UTF8_INTERN_LIMIT )
+    {
+        return rbstring;
+    }
+
+    while ( gtk3_utf8_interned_size + size > GTK3_UTF8_INTERN_LIMIT )
+    {
+        interned = g_queue_pop_tail(&gtk3_utf8_interned_order);
+
+        gtk3_utf8_interned_size -= interned->size;
+
+        g_hash_table_remove(gtk3_utf8_interned, interned->string);
+    }
+
+    interned           = g_new(RUtf8Interned, 1);
+    interned->string   = g_strndup(string, size);
+    interned->size     = size;
+    interned->rbstring = rbstring;
+
+    g_queue_push_head(&gtk3_utf8_interned_order, interned);
+
+    interned->link = gtk3_utf8_interned_order.head;
+
+    g_hash_table_insert(gtk3_utf8_interned, interned->string, interned);
+
+    gtk3_utf8_interned_size += size;
+
+    return rbstring;
+}
+
+/**
+ * Marks the Strings stored in the intern cache.
+ *
+ * @since 2026-10-19
+ * @param [void *] data Unused.
+ */
+static void gtk3_utf8_interned_mark(void *data)
+{
+    GList *link = gtk3_utf8_interned_order.head;
+
+    for ( ; link != NULL; link = link->next )
+    {
+        rb_gc_mark(((RUtf8Interned *) link->data)->rbstring);
+    }
+}
+
+/**
+ * Returns the statistics of the cache used for Strings returned by getters
+ * such as {Gtk3::Window#title}.
+ *
+ * @example
+ *  Gtk3.string_cache_stats
+ *  # => {:hits => 120, :misses => 2, :size => 2, :bytes => 14}
+ *
+ * @since  2026-10-19
+ * @return [Hash]
+ */
+static VALUE gtk3_utf8_string_cache_stats(VALUE self)
+{
+    VALUE stats = rb_hash_new();
+
+    rb_hash_aset(
+        stats,
+        ID2SYM(rb_intern("hits")),
+        SIZET2NUM(gtk3_utf8_intern_hits)
+    );
+
+    rb_hash_aset(
+        stats,
+        ID2SYM(rb_intern("misses")),
+        SIZET2NUM(gtk3_utf8_intern_misses)
+    );
+
+    rb_hash_aset(
+        stats,
+        ID2SYM(rb_intern("size")),
+        UINT2NUM(g_hash_table_size(gtk3_utf8_interned))
+    );
+
+    rb_hash_aset(
+        stats,
+        ID2SYM(rb_intern("bytes")),
+        SIZET2NUM(gtk3_utf8_interned_size)
+    );
+
+    return stats;
+}
+
+/**
+ * Sets up the String intern cache.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_utf8()
+{
+    gtk3_utf8_interned = g_hash_table_new_full(
+        g_str_hash,
+        g_str_equal,
+        NULL,
+        gtk3_utf8_interned_free
+    );
+
+    gtk3_utf8_interned_keeper = Data_Wrap_Struct(
+        0,
+        gtk3_utf8_interned_mark,
+        NULL,
+        NULL
+    );
+
+    rb_global_variable(&gtk3_utf8_interned_keeper);
+
+    rb_define_singleton_method(
+        gtk3_mGtk3,
+        "string_cache_stats",
+        gtk3_utf8_string_cache_stats,
+        0
+    );
+}
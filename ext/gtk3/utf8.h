@@ -0,0 +1,12 @@
+#ifndef GTK3_UTF8
+#define GTK3_UTF8
+
+#include "gtk3.h"
+
+extern const gchar *gtk3_string_value_utf8(VALUE *string);
+extern VALUE gtk3_utf8_new(const gchar *string);
+extern VALUE gtk3_utf8_intern(const gchar *string);
+
+extern void Init_gtk3_utf8();
+
+#endif
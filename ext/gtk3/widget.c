@@ -140,7 +140,7 @@ static VALUE gtk3_widget_connect(int argc, VALUE *argv, VALUE self)
     rb_need_block();
 
     proc    = rb_block_proc();
-    closure = gtk3_closure_new(proc, self);
+    closure = gtk3_closure_new(proc, NULL);
 
     g_signal_parse_name(
         signal_char,
@@ -527,6 +527,43 @@ static VALUE gtk3_widget_unparent(VALUE self)
     return Qnil;
 }
 
+/**
+ * Simulates a key press and release in the widget through the windowing
+ * system, the same way gtk_test_widget_send_key() does. The events are
+ * delivered by the main loop just like keys typed by the user. Returns `true`
+ * if the events were sent, `false` otherwise (e.g. when the widget isn't
+ * realized).
+ *
+ * @example
+ *  window.show
+ *  window.send_key(:q, :control)
+ *
+ *  Gtk3.main_iteration while Gtk3.events_pending?
+ *
+ * @since  2026-10-19
+ * @param  [Fixnum|Bignum|String|Symbol] key The key to press.
+ * @param  [Fixnum|Bignum|String|Symbol] modifier The modifier to hold down.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_widget_send_key(VALUE self, VALUE key, VALUE modifier)
+{
+    GtkWidget *widget;
+
+    key      = gtk3_lookup_accelerator_key(key);
+    modifier = gtk3_lookup_accelerator_modifier(modifier);
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    if ( !gtk_widget_get_realized(widget) )
+    {
+        return Qfalse;
+    }
+
+    return gtk3_gboolean_to_rboolean(
+        gtk_test_widget_send_key(widget, NUM2UINT(key), NUM2UINT(modifier))
+    );
+}
+
 /**
  * Sets up the {Gtk3::Widget} class.
  *
@@ -534,7 +571,9 @@ static VALUE gtk3_widget_unparent(VALUE self)
  */
 void Init_gtk3_widget()
 {
-    gtk3_cWidget = rb_define_class_under(gtk3_mGtk3, "Widget", rb_cObject);
+    gtk3_cWidget = rb_define_class_under(gtk3_mGtk3, "Widget", gtk3_cObject);
+
+    gtk3_object_register_class(GTK_TYPE_WIDGET, gtk3_cWidget);
 
     rb_define_method(gtk3_cWidget, "connect", gtk3_widget_connect, -1);
 
@@ -596,6 +635,8 @@ void Init_gtk3_widget()
 
     rb_define_method(gtk3_cWidget, "unparent", gtk3_widget_unparent, 0);
 
+    rb_define_method(gtk3_cWidget, "send_key", gtk3_widget_send_key, 2);
+
     gtk3_id_before = rb_intern("before");
     gtk3_id_after  = rb_intern("after");
 }
@@ -0,0 +1,491 @@
+#include "widget_query.h"
+
+/**
+ * ID for the `:depth` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_depth;
+
+/**
+ * ID for the `:breadth` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_breadth;
+
+/**
+ * ID for the `:type` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_type;
+
+/**
+ * ID for the `:name` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_name;
+
+/**
+ * ID for the `:css_class` symbol.
+ *
+ * @since 2026-10-19
+ */
+static ID gtk3_id_css_class;
+
+/* Helper methods */
+
+/**
+ * Adds the children of a widget to a traversal queue. For depth-first
+ * traversals the children are added to the head of the queue, in reverse
+ * order, so that the first child is visited next.
+ *
+ * @since 2026-10-19
+ * @param [GQueue *] queue The queue to add the children to.
+ * @param [GtkWidget *] widget The widget of which to add the children.
+ * @param [gboolean] breadth Whether the traversal is breadth-first.
+ * @param [gboolean] ref Whether to add a reference to every child.
+ */
+static void gtk3_widget_query_expand(
+    GQueue *queue,
+    GtkWidget *widget,
+    gboolean breadth,
+    gboolean ref
+)
+{
+    GList *children;
+    GList *child;
+
+    if ( !GTK_IS_CONTAINER(widget) )
+    {
+        return;
+    }
+
+    children = gtk_container_get_children(GTK_CONTAINER(widget));
+
+    if ( !breadth )
+    {
+        children = g_list_reverse(children);
+    }
+
+    for ( child = children; child != NULL; child = child->next )
+    {
+        if ( ref )
+        {
+            g_object_ref(child->data);
+        }
+
+        if ( breadth )
+        {
+            g_queue_push_tail(queue, child->data);
+        }
+        else
+        {
+            g_queue_push_head(queue, child->data);
+        }
+    }
+
+    g_list_free(children);
+}
+
+/**
+ * Returns `TRUE` if a widget matches all the criteria of a query.
+ *
+ * @since  2026-10-19
+ * @param  [GtkWidget *] widget The widget to check.
+ * @param  [RWidgetQuery *] query The criteria to check.
+ * @return [gboolean]
+ */
+static gboolean gtk3_widget_query_match(GtkWidget *widget, RWidgetQuery *query)
+{
+    if ( query->type && !g_type_is_a(G_OBJECT_TYPE(widget), query->type) )
+    {
+        return FALSE;
+    }
+
+    if ( query->name && g_strcmp0(gtk_widget_get_name(widget), query->name) )
+    {
+        return FALSE;
+    }
+
+    if ( query->css_class )
+    {
+        gtk3_widget_style_flush(widget);
+    }
+
+    if ( query->css_class
+    && !gtk_style_context_has_class(
+        gtk_widget_get_style_context(widget),
+        query->css_class
+    ) )
+    {
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+/**
+ * Parses the Hash of criteria passed to {Gtk3::Widget#find_all} and
+ * {Gtk3::Widget#find_first}. The pointers stored in the query point to the
+ * Strings in the query itself, which may be transcoded copies of the Strings
+ * in the Hash. The caller has to keep the query alive using RB_GC_GUARD()
+ * until it's done with the query.
+ *
+ * @since 2026-10-19
+ * @param [VALUE] options The Hash of criteria.
+ * @param [RWidgetQuery *] query The query to store the criteria in.
+ * @raise [TypeError] Raised when the criteria aren't a Hash.
+ */
+static void gtk3_widget_query_parse(VALUE options, RWidgetQuery *query)
+{
+    VALUE type;
+
+    query->type         = 0;
+    query->name         = NULL;
+    query->css_class    = NULL;
+    query->rb_name      = Qnil;
+    query->rb_css_class = Qnil;
+
+    if ( NIL_P(options) )
+    {
+        return;
+    }
+
+    Check_Type(options, T_HASH);
+
+    type                = rb_hash_aref(options, ID2SYM(gtk3_id_type));
+    query->rb_name      = rb_hash_aref(options, ID2SYM(gtk3_id_name));
+    query->rb_css_class = rb_hash_aref(options, ID2SYM(gtk3_id_css_class));
+
+    if ( !NIL_P(type) )
+    {
+        query->type = gtk3_object_lookup_gtype(type);
+    }
+
+    if ( !NIL_P(query->rb_name) )
+    {
+        query->name = gtk3_string_value_utf8(&query->rb_name);
+    }
+
+    if ( !NIL_P(query->rb_css_class) )
+    {
+        query->css_class = gtk3_string_value_utf8(&query->rb_css_class);
+    }
+}
+
+/**
+ * Walks the descendants of a widget depth-first and adds the ones matching
+ * the query to an array, until the limit is reached. No Ruby code runs during
+ * the walk thus the widgets aren't referenced, except for the matches.
+ *
+ * @since 2026-10-19
+ * @param [GtkWidget *] widget The widget of which to walk the descendants.
+ * @param [RWidgetQuery *] query The criteria to match.
+ * @param [GPtrArray *] matches The array to add referenced matches to.
+ * @param [guint] limit The maximum amount of matches, 0 for no limit.
+ */
+static void gtk3_widget_query_collect(
+    GtkWidget *widget,
+    RWidgetQuery *query,
+    GPtrArray *matches,
+    guint limit
+)
+{
+    GQueue queue = G_QUEUE_INIT;
+    GtkWidget *current;
+
+    gtk3_widget_query_expand(&queue, widget, FALSE, FALSE);
+
+    while ( (current = g_queue_pop_head(&queue)) )
+    {
+        if ( gtk3_widget_query_match(current, query) )
+        {
+            g_ptr_array_add(matches, g_object_ref(current));
+
+            if ( matches->len == limit )
+            {
+                break;
+            }
+        }
+
+        gtk3_widget_query_expand(&queue, current, FALSE, FALSE);
+    }
+
+    g_queue_clear(&queue);
+}
+
+/**
+ * Wraps the matches of a query in an Array, using the existing Ruby objects
+ * of the widgets where possible.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GPtrArray containing the matches.
+ * @return [Array]
+ */
+static VALUE gtk3_widget_query_wrap_matches(VALUE data)
+{
+    guint index;
+    GPtrArray *matches = (GPtrArray *) data;
+    VALUE results      = rb_ary_new2(matches->len);
+
+    for ( index = 0; index < matches->len; index++ )
+    {
+        rb_ary_push(
+            results,
+            gtk3_object_wrap(
+                Qnil,
+                g_ptr_array_index(matches, index),
+                FALSE
+            )
+        );
+    }
+
+    return results;
+}
+
+/**
+ * Releases the references of the matches and frees the array.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The GPtrArray to free.
+ * @return [VALUE]
+ */
+static VALUE gtk3_widget_query_free_matches(VALUE data)
+{
+    GPtrArray *matches = (GPtrArray *) data;
+
+    g_ptr_array_foreach(matches, (GFunc) g_object_unref, NULL);
+    g_ptr_array_free(matches, TRUE);
+
+    return Qnil;
+}
+
+/**
+ * Returns the matches of a query as an Array.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] self The widget of which to search the descendants.
+ * @param  [VALUE] options The Hash of criteria.
+ * @param  [guint] limit The maximum amount of matches, 0 for no limit.
+ * @return [Array]
+ */
+static VALUE gtk3_widget_query_find(VALUE self, VALUE options, guint limit)
+{
+    GtkWidget *widget;
+    GPtrArray *matches;
+    RWidgetQuery query;
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    /* Parse the criteria first so that errors don't leak any references. */
+    gtk3_widget_query_parse(options, &query);
+
+    matches = g_ptr_array_new();
+
+    gtk3_widget_query_collect(widget, &query, matches, limit);
+
+    RB_GC_GUARD(query.rb_name);
+    RB_GC_GUARD(query.rb_css_class);
+
+    return rb_ensure(
+        gtk3_widget_query_wrap_matches,
+        (VALUE) matches,
+        gtk3_widget_query_free_matches,
+        (VALUE) matches
+    );
+}
+
+/**
+ * Yields the descendants of the walk one by one.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RWidgetWalk of the traversal.
+ * @return [VALUE]
+ */
+static VALUE gtk3_widget_query_walk(VALUE data)
+{
+    RWidgetWalk *walk = (RWidgetWalk *) data;
+
+    while ( (walk->current = g_queue_pop_head(walk->queue)) )
+    {
+        rb_yield(gtk3_object_wrap(Qnil, walk->current, FALSE));
+
+        /* Expanded after yielding so that changes made by the block apply. */
+        gtk3_widget_query_expand(
+            walk->queue,
+            walk->current,
+            walk->breadth,
+            TRUE
+        );
+
+        g_object_unref(walk->current);
+    }
+
+    return Qnil;
+}
+
+/**
+ * Releases the references held by a traversal that finished or was aborted.
+ *
+ * @since  2026-10-19
+ * @param  [VALUE] data The RWidgetWalk of the traversal.
+ * @return [VALUE]
+ */
+static VALUE gtk3_widget_query_walk_free(VALUE data)
+{
+    RWidgetWalk *walk = (RWidgetWalk *) data;
+
+    if ( walk->current )
+    {
+        g_object_unref(walk->current);
+    }
+
+    g_queue_free_full(walk->queue, g_object_unref);
+
+    return Qnil;
+}
+
+/* Instance methods */
+
+/**
+ * Yields every descendant of the widget, depth-first by default. Children are
+ * looked up as the traversal progresses, thus widgets added by the block are
+ * visited too. Ruby objects are only created for the widgets that are yielded
+ * and existing objects are reused.
+ *
+ * @example
+ *  window.each_descendant(:breadth) { |widget| puts widget.class }
+ *
+ * @since 2026-10-19
+ * @param [Symbol] order Either `:depth` or `:breadth`.
+ * @raise [ArgumentError] Raised when an invalid order was specified.
+ * @yieldparam [Gtk3::Widget] widget
+ */
+static VALUE gtk3_widget_query_each_descendant(
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    VALUE order;
+    GtkWidget *widget;
+    RWidgetWalk walk;
+
+    RETURN_ENUMERATOR(self, argc, argv);
+
+    rb_scan_args(argc, argv, "01", &order);
+
+    if ( NIL_P(order) )
+    {
+        order = ID2SYM(gtk3_id_depth);
+    }
+
+    if ( order != ID2SYM(gtk3_id_depth) && order != ID2SYM(gtk3_id_breadth) )
+    {
+        rb_raise(
+            rb_eArgError,
+            "invalid traversal order %s (expected :depth or :breadth)",
+            RSTRING_PTR(rb_inspect(order))
+        );
+    }
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    walk.queue   = g_queue_new();
+    walk.current = NULL;
+    walk.breadth = order == ID2SYM(gtk3_id_breadth);
+
+    gtk3_widget_query_expand(walk.queue, widget, walk.breadth, TRUE);
+
+    rb_ensure(
+        gtk3_widget_query_walk,
+        (VALUE) &walk,
+        gtk3_widget_query_walk_free,
+        (VALUE) &walk
+    );
+
+    return self;
+}
+
+/**
+ * Returns all descendants matching the given criteria, in depth-first order.
+ * The tree is searched natively, Ruby objects are only created for the
+ * matches.
+ *
+ * @example
+ *  window.find_all(:type => :GtkButton, :css_class => 'suggested-action')
+ *
+ * @since  2026-10-19
+ * @param  [Hash] options The criteria to match.
+ * @option options [Class|String|Symbol] :type The type of the widgets,
+ *  subclasses match as well.
+ * @option options [String] :name The name of the widgets.
+ * @option options [String] :css_class A style class the widgets should have.
+ * @return [Array]
+ */
+static VALUE gtk3_widget_query_find_all(int argc, VALUE *argv, VALUE self)
+{
+    VALUE options;
+
+    rb_scan_args(argc, argv, "01", &options);
+
+    return gtk3_widget_query_find(self, options, 0);
+}
+
+/**
+ * Returns the first descendant matching the given criteria, or `nil`. The
+ * criteria are the same as those of {Gtk3::Widget#find_all}.
+ *
+ * @example
+ *  window.find_first(:name => 'save')
+ *
+ * @since  2026-10-19
+ * @param  [Hash] options The criteria to match.
+ * @return [Gtk3::Widget|NilClass]
+ */
+static VALUE gtk3_widget_query_find_first(int argc, VALUE *argv, VALUE self)
+{
+    VALUE options;
+
+    rb_scan_args(argc, argv, "01", &options);
+
+    return rb_ary_entry(gtk3_widget_query_find(self, options, 1), 0);
+}
+
+/**
+ * Adds the traversal and query methods to {Gtk3::Widget}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_widget_query()
+{
+    gtk3_id_depth     = rb_intern("depth");
+    gtk3_id_breadth   = rb_intern("breadth");
+    gtk3_id_type      = rb_intern("type");
+    gtk3_id_name      = rb_intern("name");
+    gtk3_id_css_class = rb_intern("css_class");
+
+    rb_define_method(
+        gtk3_cWidget,
+        "each_descendant",
+        gtk3_widget_query_each_descendant,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cWidget,
+        "find_all",
+        gtk3_widget_query_find_all,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cWidget,
+        "find_first",
+        gtk3_widget_query_find_first,
+        -1
+    );
+}
@@ -0,0 +1,48 @@
+#ifndef GTK3_WIDGET_QUERY
+#define GTK3_WIDGET_QUERY
+
+#include "gtk3.h"
+
+/**
+ * Structure containing the criteria used by {Gtk3::Widget#find_all} and
+ * {Gtk3::Widget#find_first}. Criteria that aren't used are set to 0 or NULL.
+ *
+ * * type: the GType the widgets should be an instance of.
+ * * name: the name of the widgets.
+ * * css_class: the style class the widgets should have.
+ * * rb_name: the String `name` points to, kept so that it stays alive.
+ * * rb_css_class: the String `css_class` points to.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RWidgetQuery
+{
+    GType type;
+    const gchar *name;
+    const gchar *css_class;
+    VALUE rb_name;
+    VALUE rb_css_class;
+} RWidgetQuery;
+
+/**
+ * Structure containing the state of a lazy traversal started by
+ * {Gtk3::Widget#each_descendant}. All widgets in the queue and the current
+ * widget are referenced so that the traversal can continue even if the block
+ * destroys widgets.
+ *
+ * * queue: the widgets that have yet to be visited.
+ * * current: the widget that is being yielded.
+ * * breadth: whether the traversal is breadth-first.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RWidgetWalk
+{
+    GQueue *queue;
+    GtkWidget *current;
+    gboolean breadth;
+} RWidgetWalk;
+
+extern void Init_gtk3_widget_query();
+
+#endif
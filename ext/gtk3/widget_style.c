@@ -0,0 +1,366 @@
+#include "widget_style.h"
+
+/**
+ * Quark used for storing the RWidgetStyle of a widget.
+ *
+ * @since 2026-10-19
+ */
+static GQuark gtk3_widget_style_quark;
+
+/* Helper methods */
+
+/**
+ * Frees the pending style class changes of a widget.
+ *
+ * @since 2026-10-19
+ * @param [gpointer] data The RWidgetStyle to free.
+ */
+static void gtk3_widget_style_free(gpointer data)
+{
+    RWidgetStyle *style = (RWidgetStyle *) data;
+
+    g_array_free(style->changes, TRUE);
+    g_free(style);
+}
+
+/**
+ * Returns the pending style class changes of a widget, creating them if
+ * needed.
+ *
+ * @since  2026-10-19
+ * @param  [GtkWidget *] widget The widget.
+ * @return [RWidgetStyle *]
+ */
+static RWidgetStyle *gtk3_widget_style_get(GtkWidget *widget)
+{
+    RWidgetStyle *style;
+
+    style = g_object_get_qdata(G_OBJECT(widget), gtk3_widget_style_quark);
+
+    if ( style != NULL )
+    {
+        return style;
+    }
+
+    style          = g_new(RWidgetStyle, 1);
+    style->tick_id = 0;
+    style->changes = g_array_new(FALSE, FALSE, sizeof(RStyleChange));
+
+    g_object_set_qdata_full(
+        G_OBJECT(widget),
+        gtk3_widget_style_quark,
+        style,
+        gtk3_widget_style_free
+    );
+
+    return style;
+}
+
+/**
+ * Applies the pending style class changes of a widget.
+ *
+ * @since 2026-10-19
+ * @param [GtkWidget *] widget The widget.
+ * @param [RWidgetStyle *] style The pending changes of the widget.
+ */
+static void gtk3_widget_style_apply(GtkWidget *widget, RWidgetStyle *style)
+{
+    guint index;
+    RStyleChange *change;
+    GtkStyleContext *context = gtk_widget_get_style_context(widget);
+
+    for ( index = 0; index < style->changes->len; index++ )
+    {
+        change = &g_array_index(style->changes, RStyleChange, index);
+
+        if ( change->add )
+        {
+            gtk_style_context_add_class(
+                context,
+                g_quark_to_string(change->css_class)
+            );
+        }
+        else
+        {
+            gtk_style_context_remove_class(
+                context,
+                g_quark_to_string(change->css_class)
+            );
+        }
+    }
+
+    g_array_set_size(style->changes, 0);
+}
+
+/**
+ * Called by the frame clock before the next frame of a widget is drawn.
+ * Applies all style class changes made since the previous frame at once.
+ *
+ * @since  2026-10-19
+ * @param  [GtkWidget *] widget The widget.
+ * @param  [GdkFrameClock *] clock The frame clock of the widget.
+ * @param  [gpointer] data Unused.
+ * @return [gboolean]
+ */
+static gboolean gtk3_widget_style_tick(
+    GtkWidget *widget,
+    GdkFrameClock *clock,
+    gpointer data
+)
+{
+    RWidgetStyle *style = gtk3_widget_style_get(widget);
+
+    style->tick_id = 0;
+
+    gtk3_widget_style_apply(widget, style);
+
+    return G_SOURCE_REMOVE;
+}
+
+/**
+ * Applies the pending style class changes of a widget right away. This is
+ * used before reading the style classes of a widget so that pending changes
+ * are always visible to Ruby code.
+ *
+ * @since 2026-10-19
+ * @param [GtkWidget *] widget The widget.
+ */
+void gtk3_widget_style_flush(GtkWidget *widget)
+{
+    RWidgetStyle *style;
+
+    style = g_object_get_qdata(G_OBJECT(widget), gtk3_widget_style_quark);
+
+    if ( style == NULL || style->changes->len == 0 )
+    {
+        return;
+    }
+
+    if ( style->tick_id > 0 )
+    {
+        gtk_widget_remove_tick_callback(widget, style->tick_id);
+
+        style->tick_id = 0;
+    }
+
+    gtk3_widget_style_apply(widget, style);
+}
+
+/**
+ * Queues style class changes for a widget. A later change of the same class
+ * replaces an earlier one. The changes of realized widgets are applied before
+ * the next frame, those of other widgets are applied right away as there's no
+ * frame to wait for.
+ *
+ * @since 2026-10-19
+ * @param [VALUE] self The widget.
+ * @param [int] argc The amount of class names.
+ * @param [VALUE *] argv The class names as Strings or Symbols.
+ * @param [gboolean] add Whether to add or remove the classes.
+ */
+static void gtk3_widget_style_queue(
+    VALUE self,
+    int argc,
+    VALUE *argv,
+    gboolean add
+)
+{
+    int index;
+    guint pending;
+    VALUE name;
+    GQuark *classes;
+    GtkWidget *widget;
+    RWidgetStyle *style;
+    RStyleChange *change;
+    RStyleChange new_change;
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    classes = ALLOCA_N(GQuark, argc);
+
+    /* Convert all names first so invalid names don't leave partial changes. */
+    for ( index = 0; index < argc; index++ )
+    {
+        name = SYMBOL_P(argv[index]) ? rb_sym_to_s(argv[index]) : argv[index];
+
+        classes[index] = g_quark_from_string(gtk3_string_value_utf8(&name));
+    }
+
+    style = gtk3_widget_style_get(widget);
+
+    for ( index = 0; index < argc; index++ )
+    {
+        for ( pending = 0; pending < style->changes->len; pending++ )
+        {
+            change = &g_array_index(style->changes, RStyleChange, pending);
+
+            if ( change->css_class == classes[index] )
+            {
+                change->add = add;
+
+                break;
+            }
+        }
+
+        if ( pending == style->changes->len )
+        {
+            new_change.css_class = classes[index];
+            new_change.add       = add;
+
+            g_array_append_val(style->changes, new_change);
+        }
+    }
+
+    if ( !gtk_widget_get_realized(widget) )
+    {
+        gtk3_widget_style_flush(widget);
+    }
+    else if ( style->tick_id == 0 && style->changes->len > 0 )
+    {
+        style->tick_id = gtk_widget_add_tick_callback(
+            widget,
+            gtk3_widget_style_tick,
+            NULL,
+            NULL
+        );
+    }
+}
+
+/* Instance methods */
+
+/**
+ * Adds style classes to the widget. Changes made to realized widgets are
+ * batched and applied before the next frame, so the style of the widget is
+ * only recomputed once regardless of how many classes are changed.
+ *
+ * @example
+ *  button.add_classes('suggested-action', :flat)
+ *
+ * @since  2026-10-19
+ * @param  [Array] names The names of the classes as Strings or Symbols.
+ * @return [Gtk3::Widget]
+ */
+static VALUE gtk3_widget_style_add_classes(int argc, VALUE *argv, VALUE self)
+{
+    gtk3_widget_style_queue(self, argc, argv, TRUE);
+
+    return self;
+}
+
+/**
+ * Removes style classes from the widget. Changes are batched the same way as
+ * {Gtk3::Widget#add_classes}.
+ *
+ * @since  2026-10-19
+ * @param  [Array] names The names of the classes as Strings or Symbols.
+ * @return [Gtk3::Widget]
+ */
+static VALUE gtk3_widget_style_remove_classes(
+    int argc,
+    VALUE *argv,
+    VALUE self
+)
+{
+    gtk3_widget_style_queue(self, argc, argv, FALSE);
+
+    return self;
+}
+
+/**
+ * Returns the names of the style classes of the widget, including changes
+ * that have yet to be applied.
+ *
+ * @since  2026-10-19
+ * @return [Array]
+ */
+static VALUE gtk3_widget_style_css_classes(VALUE self)
+{
+    GtkWidget *widget;
+    GList *classes;
+    GList *current;
+    VALUE names;
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    gtk3_widget_style_flush(widget);
+
+    classes = gtk_style_context_list_classes(
+        gtk_widget_get_style_context(widget)
+    );
+
+    names = rb_ary_new();
+
+    for ( current = classes; current != NULL; current = current->next )
+    {
+        rb_ary_push(names, gtk3_utf8_new((const gchar *) current->data));
+    }
+
+    g_list_free(classes);
+
+    return names;
+}
+
+/**
+ * Returns `true` if the widget has the given style class, including changes
+ * that have yet to be applied.
+ *
+ * @since  2026-10-19
+ * @param  [String|Symbol] name The name of the class.
+ * @return [TrueClass|FalseClass]
+ */
+static VALUE gtk3_widget_style_has_class(VALUE self, VALUE name)
+{
+    GtkWidget *widget;
+
+    Data_Get_Struct(self, GtkWidget, widget);
+
+    if ( SYMBOL_P(name) )
+    {
+        name = rb_sym_to_s(name);
+    }
+
+    gtk3_widget_style_flush(widget);
+
+    return gtk_style_context_has_class(
+        gtk_widget_get_style_context(widget),
+        gtk3_string_value_utf8(&name)
+    ) ? Qtrue : Qfalse;
+}
+
+/**
+ * Initializes the style class methods of {Gtk3::Widget}.
+ *
+ * @since 2026-10-19
+ */
+void Init_gtk3_widget_style()
+{
+    gtk3_widget_style_quark = g_quark_from_static_string("gtk3-widget-style");
+
+    rb_define_method(
+        gtk3_cWidget,
+        "add_classes",
+        gtk3_widget_style_add_classes,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cWidget,
+        "remove_classes",
+        gtk3_widget_style_remove_classes,
+        -1
+    );
+
+    rb_define_method(
+        gtk3_cWidget,
+        "css_classes",
+        gtk3_widget_style_css_classes,
+        0
+    );
+
+    rb_define_method(
+        gtk3_cWidget,
+        "has_class?",
+        gtk3_widget_style_has_class,
+        1
+    );
+}
@@ -0,0 +1,36 @@
+#ifndef GTK3_WIDGET_STYLE
+#define GTK3_WIDGET_STYLE
+
+#include "gtk3.h"
+
+/**
+ * Structure containing a style class change that has yet to be applied.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RStyleChange
+{
+    GQuark css_class;
+    gboolean add;
+} RStyleChange;
+
+/**
+ * Structure containing the pending style class changes of a widget. It's
+ * stored as qdata on the widget.
+ *
+ * * changes: array of RStyleChange structures, in the order they were made.
+ * * tick_id: the ID of the tick callback that applies the changes, or 0.
+ *
+ * @since 2026-10-19
+ */
+typedef struct RWidgetStyle
+{
+    GArray *changes;
+    guint tick_id;
+} RWidgetStyle;
+
+extern void gtk3_widget_style_flush(GtkWidget *widget);
+
+extern void Init_gtk3_widget_style();
+
+#endif
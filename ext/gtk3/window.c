@@ -44,7 +44,7 @@ VALUE gtk3_cWindow;
  */
 static VALUE gtk3_window_new(int argc, VALUE *argv, VALUE class)
 {
-    VALUE struct_data;
+    VALUE rb_window;
     VALUE type;
     ID type_id;
     GtkWindowType window_type;
@@ -91,21 +91,20 @@ static VALUE gtk3_window_new(int argc, VALUE *argv, VALUE class)
         );
     }
 
-    window      = gtk_window_new(window_type);
-    struct_data = Data_Wrap_Struct(
-        class,
-        NULL,
-        NULL,
-        window
-    );
+    gtk3_ensure_init();
+
+    /* The initial reference of a window is owned by GTK, not the caller. */
+    window    = gtk_window_new(window_type);
+    rb_window = gtk3_object_wrap(class, window, FALSE);
 
-    rb_obj_call_init(struct_data, 0, NULL);
+    rb_obj_call_init(rb_window, 0, NULL);
 
-    return struct_data;
+    return rb_window;
 }
 
 /**
- * Returns the title of a window.
+ * Returns the title of a window. The returned String is frozen and the same
+ * String is returned for as long as the title doesn't change.
  *
  * @example
  *  window       = Gtk3::Window.new
@@ -118,21 +117,11 @@ static VALUE gtk3_window_new(int argc, VALUE *argv, VALUE class)
  */
 static VALUE gtk3_window_get_title(VALUE self)
 {
-    const gchar *title;
     GtkWindow *window;
 
     Data_Get_Struct(self, GtkWindow, window);
 
-    title = gtk_window_get_title(window);
-
-    if ( title != NULL )
-    {
-        return rb_str_new2(title);
-    }
-    else
-    {
-        return Qnil;
-    }
+    return gtk3_utf8_intern(gtk_window_get_title(window));
 }
 
 /**
@@ -149,7 +138,7 @@ static VALUE gtk3_window_set_title(VALUE self, VALUE title)
 
     Data_Get_Struct(self, GtkWindow, window);
 
-    gtk_window_set_title(window, StringValuePtr(title));
+    gtk_window_set_title(window, gtk3_string_value_utf8(&title));
 
     return Qnil;
 }
@@ -457,7 +446,13 @@ static VALUE gtk3_window_get_destroy_with_parent(VALUE self)
  */
 void Init_gtk3_window()
 {
-    gtk3_cWindow = rb_define_class_under(gtk3_mGtk3, "Window", gtk3_cWidget);
+    gtk3_cWindow = rb_define_class_under(
+        gtk3_mGtk3,
+        "Window",
+        gtk3_cContainer
+    );
+
+    gtk3_object_register_class(GTK_TYPE_WINDOW, gtk3_cWindow);
 
     rb_define_singleton_method(gtk3_cWindow, "new", gtk3_window_new, -1);
 
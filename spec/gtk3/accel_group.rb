@@ -19,6 +19,23 @@ describe 'Gtk3::AccelGroup' do
     Gtk3::AccelGroup.accelerator_label('q', :shift).should  == 'Shift+Q'
   end
 
+  it 'Cache accelerator names and labels' do
+    name  = Gtk3::AccelGroup.accelerator_name(:q, :control)
+    label = Gtk3::AccelGroup.accelerator_label(:q, :control)
+
+    name.frozen?.should  == true
+    label.frozen?.should == true
+
+    Gtk3::AccelGroup.accelerator_name(:q, :control).equal?(name).should == true
+    Gtk3::AccelGroup.accelerator_label(:q, :control).equal?(label) \
+      .should == true
+
+    Gtk3::AccelGroup.default_modifier = Gtk3::AccelGroup.default_modifier
+
+    Gtk3::AccelGroup.accelerator_name(:q, :control).equal?(name) \
+      .should == false
+  end
+
   it 'Set the default accelerator modifier' do
     default = Gtk3::AccelGroup.default_modifier
 
@@ -115,10 +132,11 @@ describe 'Gtk3::AccelGroup' do
   end
 
   it 'Query an accelerator group' do
-    group   = Gtk3::AccelGroup.new
-    entries = []
+    group    = Gtk3::AccelGroup.new
+    entries  = []
+    callback = proc {}
 
-    group.connect(113, :control, :visible) {}
+    group.connect(113, :control, :visible, &callback)
 
     entries = group.query(113, :control)
 
@@ -127,11 +145,24 @@ describe 'Gtk3::AccelGroup' do
     entries[0].modifier.should == Gtk3::ModifierType::CONTROL
     entries[0].flags.should    == Gtk3::AccelFlag::VISIBLE
     entries[0].path.should     == '<Primary>q'
+    entries[0].callback.should == callback
 
     group.query(:q, :control).length.should == 1
     group.query('q', :control).length.should == 1
   end
 
+  it 'Count the entries of an accelerator group' do
+    group = Gtk3::AccelGroup.new
+
+    group.query_count(:q, :control).should == 0
+
+    group.connect(:q, :control, :visible) {}
+    group.connect(:q, :control, :visible) {}
+
+    group.query_count(:q, :control).should == 2
+    group.query_count(:q, :shift).should   == 0
+  end
+
   it 'Install and disconnect and accelerator' do
     group = Gtk3::AccelGroup.new
 
@@ -153,4 +184,104 @@ describe 'Gtk3::AccelGroup' do
 
     group.query(:p, :control).length.should == 0
   end
+
+  it 'Enumerate all the entries of an accelerator group' do
+    group = Gtk3::AccelGroup.new
+
+    group.to_a.should == []
+    group.size.should == 0
+
+    group.connect(:q, :control, :visible) {}
+    group.connect(:p, :shift, :visible) {}
+
+    group.size.should        == 2
+    group.to_a.length.should == 2
+
+    group.map(&:path).sort.should == ['<Primary>q', '<Shift>p']
+
+    group.each.size.should == 2
+
+    group.lazy.select { |entry| entry.key == 113 }.first(1).length \
+      .should == 1
+
+    # Disconnecting accelerators while iterating is safe.
+    group.each { |entry| group.disconnect_key(entry.key, entry.modifier) }
+
+    group.size.should == 0
+  end
+
+  it 'Bind a table of accelerators' do
+    group = Gtk3::AccelGroup.new
+    save  = proc {}
+    quit  = proc {}
+    other = proc {}
+
+    group.bind_table('<Control>s' => save, [:q, :control] => quit)
+
+    group.query_count(:s, :control).should == 1
+    group.query_count(:q, :control).should == 1
+
+    group.query(:s, :control)[0].callback.should == save
+
+    # Swapping the table keeps existing bindings and removes unused ones.
+    group.bind_table('<Control>s' => other, '<Shift>p' => quit)
+
+    group.query_count(:s, :control).should == 1
+    group.query_count(:q, :control).should == 0
+    group.query_count(:p, :shift).should   == 1
+
+    group.query(:s, :control)[0].callback.should == other
+
+    group.bind_table({})
+
+    group.size.should == 0
+  end
+
+  it 'Activate a binding of a table' do
+    group  = Gtk3::AccelGroup.new
+    window = Gtk3::Window.new
+    called = []
+
+    group.bind_table('<Control>s' => proc { |arg| called << arg; true })
+
+    group.activate(window, :s, :control).should == true
+    group.activate(window, :q, :control).should == false
+
+    called.length.should           == 1
+    called[0].equal?(group).should == true
+
+    window.destroy
+  end
+
+  it 'Raise errors of table bindings once the activation finishes' do
+    group  = Gtk3::AccelGroup.new
+    window = Gtk3::Window.new
+
+    group.bind_table('<Control>s' => proc { raise 'failed' })
+
+    should.raise?(RuntimeError) { group.activate(window, :s, :control) } \
+      .message.should == 'failed'
+
+    group.bind_table('<Control>s' => proc { true })
+
+    group.activate(window, :s, :control).should == true
+
+    window.destroy
+  end
+
+  it 'Bind a table using invalid accelerators or callables' do
+    group = Gtk3::AccelGroup.new
+
+    group.bind_table('<Control>s' => proc {})
+
+    should.raise?(ArgumentError) { group.bind_table('<Foo' => proc {}) } \
+      .message.should == 'invalid accelerator <Foo'
+
+    should.raise?(TypeError) { group.bind_table('<Control>q' => 10) }
+    should.raise?(TypeError) { group.bind_table(10 => proc {}) }
+
+    # The existing table is left untouched.
+    group.query_count(:s, :control).should == 1
+    group.query_count(:q, :control).should == 0
+  end
 end
@@ -16,4 +16,10 @@ describe 'Gtk3::AccelGroupEntry' do
     entry.path.should     == '<Primary>q'
     entry.callback.should == callback
   end
+
+  it 'Initialize an entry using an invalid callback' do
+    should.raise?(TypeError) do
+      Gtk3::AccelGroupEntry.new(113, 0, 0, 'foo')
+    end.message.should == 'wrong argument type String (expected Proc)'
+  end
 end
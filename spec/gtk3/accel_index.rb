@@ -0,0 +1,68 @@
+require File.expand_path('../../helper', __FILE__)
+
+describe 'Gtk3::AccelIndex' do
+  it 'Track conflicting accelerators of groups' do
+    group1 = Gtk3::AccelGroup.new
+    group2 = Gtk3::AccelGroup.new
+    mod1   = Gtk3::ModifierType::MOD1
+
+    group1.connect(:j, :mod1, :visible) {}
+
+    Gtk3::AccelIndex.owners(:j, :mod1).should == [group1]
+
+    Gtk3::AccelIndex.conflicts.select { |key, mod| key == 106 && mod == mod1 } \
+      .should == []
+
+    group2.connect(:j, :mod1, :visible) {}
+
+    conflict = Gtk3::AccelIndex.conflicts.find do |key, mod|
+      key == 106 && mod == mod1
+    end
+
+    conflict[2].length.should == 2
+
+    group2.disconnect_key(:j, :mod1)
+
+    Gtk3::AccelIndex.owners(:j, :mod1).should == [group1]
+
+    group1.disconnect_key(:j, :mod1)
+
+    Gtk3::AccelIndex.owners(:j, :mod1).should == []
+  end
+
+  it 'Track conflicting accelerator map paths' do
+    group = Gtk3::AccelGroup.new
+
+    group.connect(:k, :mod1, :visible) {}
+
+    Gtk3::AccelMap.add_entry('<AccelIndex>/Test', 107, :mod1)
+
+    Gtk3::AccelIndex.owners(:k, :mod1).length.should == 2
+    Gtk3::AccelIndex.owners(:k, :mod1).include?('<AccelIndex>/Test') \
+      .should == true
+
+    # Entries connected using a path are tracked as part of the map.
+    group.connect_by_path('<AccelIndex>/Test') {}
+
+    Gtk3::AccelIndex.owners(:k, :mod1).length.should == 2
+
+    Gtk3::AccelMap.change_entry('<AccelIndex>/Test', 108, :mod1)
+
+    Gtk3::AccelIndex.owners(:k, :mod1).should == [group]
+    Gtk3::AccelIndex.owners(:l, :mod1).should == ['<AccelIndex>/Test']
+  end
+
+  it 'Track groups that are created by GTK' do
+    builder = Gtk3::Builder.new
+
+    builder.add_from_string(
+      '<interface><object class="GtkAccelGroup" id="accels"/></interface>'
+    )
+
+    group = builder['accels']
+
+    group.connect(:m, :mod1, :visible) {}
+
+    Gtk3::AccelIndex.owners(:m, :mod1).should == [group]
+  end
+end
@@ -0,0 +1,80 @@
+require File.expand_path('../../helper', __FILE__)
+require 'tmpdir'
+
+describe 'Gtk3::AccelMap journal' do
+  it 'Record and replay accelerator changes' do
+    Dir.mktmpdir do |dir|
+      base    = File.join(dir, 'keymap.rc')
+      journal = base + '.journal'
+
+      Gtk3::AccelMap.add_entry('<Journal>/Test', 97, :control)
+      Gtk3::AccelMap.open_journal(base, 0)
+
+      Gtk3::AccelMap.journal_open?.should == true
+
+      should.raise?(RuntimeError) { Gtk3::AccelMap.open_journal(base) } \
+        .message.should == 'the accelerator journal is already open'
+
+      Gtk3::AccelMap.change_entry('<Journal>/Test', 98, :control, true)
+
+      File.read(journal).include?('"<Journal>/Test"').should == true
+      File.exist?(base).should                               == false
+
+      Gtk3::AccelMap.change_entry('<Journal>/Test', 99, :control, true)
+      Gtk3::AccelMap.close_journal
+
+      Gtk3::AccelMap.journal_open?.should                 == false
+      File.read(journal).should                           == ''
+      File.read(base).include?('"<Journal>/Test"').should == true
+
+      File.open(journal, 'w') do |handle|
+        handle.write('(gtk_accel_path "<Journal>/Test" "<Control>e")')
+      end
+
+      Gtk3::AccelMap.load_journal(base)
+
+      Gtk3::AccelMap.lookup_entry('<Journal>/Test').key.should == 101
+    end
+  end
+
+  it 'Only record changed accelerators in the journal' do
+    Dir.mktmpdir do |dir|
+      base    = File.join(dir, 'keymap.rc')
+      journal = base + '.journal'
+
+      Gtk3::AccelMap.add_entry('<Journal>/Default', 97, :control)
+      Gtk3::AccelMap.open_journal(base, 0)
+
+      Gtk3::AccelMap.add_entry('<Journal>/Default', 98, :control)
+      Gtk3::AccelMap.add_entry('<Journal>/Other', 99, :control)
+
+      File.read(journal).should == ''
+
+      Gtk3::AccelMap.change_entry('<Journal>/Default', 100, :control, true)
+
+      File.read(journal).include?('"<Journal>/Default"').should == true
+
+      Gtk3::AccelMap.close_journal
+    end
+  end
+
+  it 'Compact the journal after a number of changes' do
+    Dir.mktmpdir do |dir|
+      base = File.join(dir, 'keymap.rc')
+
+      Gtk3::AccelMap.add_entry('<Journal>/Compact', 97, :control)
+      Gtk3::AccelMap.open_journal(base, 2)
+
+      Gtk3::AccelMap.change_entry('<Journal>/Compact', 98, :control, true)
+
+      File.exist?(base).should == false
+
+      Gtk3::AccelMap.change_entry('<Journal>/Compact', 99, :control, true)
+
+      File.exist?(base).should            == true
+      File.read(base + '.journal').should == ''
+
+      Gtk3::AccelMap.close_journal
+    end
+  end
+end
@@ -1,5 +1,6 @@
 require File.expand_path('../../helper', __FILE__)
 require 'tempfile'
+require 'stringio'
 
 describe 'Gtk3::AccelMap' do
   it 'Add and lookup an accelerator mapping' do
@@ -148,4 +149,216 @@ describe 'Gtk3::AccelMap' do
     entry.key.should      == 113
     entry.modifier.should == Gtk3::ModifierType::CONTROL
   end
+
+  it 'Import and export accelerator mappings' do
+    Gtk3::AccelMap.import(
+      '<Import>/Save' => '<Control>s',
+      '<Import>/Quit' => [113, Gtk3::ModifierType::CONTROL],
+      '<Import>/Open' => [:o, :control]
+    ).should == 3
+
+    Gtk3::AccelMap.lookup_entry('<Import>/Save').key.should == 115
+    Gtk3::AccelMap.lookup_entry('<Import>/Open').key.should == 111
+
+    # Existing entries are changed.
+    Gtk3::AccelMap.import('<Import>/Save' => '<Shift>s')
+
+    Gtk3::AccelMap.lookup_entry('<Import>/Save').modifier \
+      .should == Gtk3::ModifierType::SHIFT
+
+    hash = Gtk3::AccelMap.to_h
+
+    hash['<Import>/Quit'].should == [113, Gtk3::ModifierType::CONTROL]
+    hash.keys.find { |path| path == '<Import>/Quit' }.frozen?.should == true
+
+    Gtk3::AccelMap.to_h(:changed_only => true).key?('<Import>/Save') \
+      .should == true
+  end
+
+  it 'Import invalid accelerator mappings' do
+    should.raise?(ArgumentError) do
+      Gtk3::AccelMap.import('<Import>/Invalid' => '<Foo')
+    end.message.should == 'invalid accelerator <Foo'
+
+    should.raise?(TypeError) do
+      Gtk3::AccelMap.import('<Import>/Invalid' => 10)
+    end
+
+    Gtk3::AccelMap.lookup_entry('<Import>/Invalid').should == nil
+  end
+
+  it 'Load accelerator specifications from a String' do
+    Gtk3::AccelMap.lookup_entry('<Test>/String').should == nil
+
+    Gtk3::AccelMap.load_string(
+      '(gtk_accel_path "<Test>/String" "<Control>s")'
+    )
+
+    entry = Gtk3::AccelMap.lookup_entry('<Test>/String')
+
+    entry.key.should      == 115
+    entry.modifier.should == Gtk3::ModifierType::CONTROL
+  end
+
+  it 'Dump the accelerator specifications' do
+    Gtk3::AccelMap.add_entry('<Test>/Dump', 100, :control)
+
+    dump = Gtk3::AccelMap.dump
+
+    dump.encoding.should                  == Encoding::UTF_8
+    dump.include?('"<Test>/Dump"').should == true
+  end
+
+  it 'Save and load accelerator specifications using an IO' do
+    io = StringIO.new
+
+    Gtk3::AccelMap.change_entry('<Test>/Dump', 101, :control, true)
+    Gtk3::AccelMap.save_io(io).should == io
+
+    Gtk3::AccelMap.change_entry('<Test>/Dump', 102, :control, true)
+
+    io.rewind
+
+    Gtk3::AccelMap.load_io(io)
+
+    Gtk3::AccelMap.lookup_entry('<Test>/Dump').key.should == 101
+  end
+
+  it 'Save the accelerator specifications asynchronously' do
+    file   = Tempfile.new('ruby_gtk3')
+    result = nil
+
+    Gtk3::AccelMap.save_async(file.path) { |value| result = value }.should == nil
+
+    Gtk3.main_iteration while result.nil?
+
+    result.should                                       == true
+    File.read(file.path).include?('<Test>/Test').should == true
+
+    file.close
+  end
+
+  it 'Report errors when saving asynchronously' do
+    result = nil
+
+    Gtk3::AccelMap.save_async('/non-existing/keymap.rc') do |value|
+      result = value
+    end
+
+    Gtk3.main_iteration while result.nil?
+
+    result.is_a?(IOError).should == true
+  end
+
+  it 'Raise errors of asynchronous save callbacks from the main loop' do
+    file = Tempfile.new('ruby_gtk3')
+    done = false
+
+    Gtk3::AccelMap.save_async(file.path) do
+      done = true
+
+      raise ArgumentError, 'callback failed'
+    end
+
+    error = should.raise?(ArgumentError) do
+      Gtk3.main_iteration until done
+    end
+
+    error.message.should == 'callback failed'
+
+    file.close
+  end
+
+  it 'Search accelerator paths' do
+    Gtk3::AccelMap.add_entry('<Search>/File/Save', 115, :control)
+    Gtk3::AccelMap.add_entry('<Search>/File/Save As', 83, :control)
+    Gtk3::AccelMap.add_entry('<Search>/Edit/Select All', 97, :control)
+
+    Gtk3::AccelMap.search('<search>/file/', 1).map(&:first) \
+      .should == ['<Search>/File/Save']
+
+    results = Gtk3::AccelMap.search('<search>/fs', 2)
+    label   = Gtk3::AccelGroup.accelerator_label(115, :control)
+
+    results.map(&:first).should \
+      == ['<Search>/File/Save', '<Search>/File/Save As']
+
+    results[0][1].should == label
+
+    Gtk3::AccelMap.search('<search>/sall').map(&:first) \
+      .should == ['<Search>/Edit/Select All']
+
+    Gtk3::AccelMap.search('<Search>/xyz').should == []
+
+    Gtk3::AccelMap.search('<search>/file/', 2**31 - 1).map(&:first) \
+      .should == ['<Search>/File/Save', '<Search>/File/Save As']
+
+    should.raise?(ArgumentError) { Gtk3::AccelMap.search('', -1) } \
+      .message.should == 'negative limit'
+  end
+
+  it 'Coalesce accelerator change notifications' do
+    calls   = []
+    handler = Gtk3::AccelMap.on_changed { |paths| calls << paths }
+
+    Gtk3::AccelMap.add_entry('<Notify>/A', 97, :control)
+    Gtk3::AccelMap.add_entry('<Notify>/B', 98, :control)
+    Gtk3::AccelMap.change_entry('<Notify>/A', 99, :control, true)
+    Gtk3::AccelMap.change_entry('<Notify>/B', 96, :control, true)
+
+    calls.should == []
+
+    Gtk3.main_iteration while Gtk3.events_pending?
+
+    calls.should == [['<Notify>/A', '<Notify>/B']]
+
+    calls.clear
+
+    # Registering entries isn't a change, neither are existing entries.
+    Gtk3::AccelMap.add_entry('<Notify>/A', 102, :control)
+    Gtk3::AccelMap.add_entry('<Notify>/C', 103, :control)
+
+    Gtk3.main_iteration while Gtk3.events_pending?
+
+    calls.should                                         == []
+    Gtk3::AccelMap.lookup_entry('<Notify>/A').key.should == 99
+
+    calls.clear
+
+    Gtk3::AccelMap.batch do
+      Gtk3::AccelMap.change_entry('<Notify>/A', 100, :control, true)
+      Gtk3::AccelMap.change_entry('<Notify>/B', 101, :control, true)
+
+      Gtk3.main_iteration while Gtk3.events_pending?
+
+      calls.should == []
+
+      :done
+    end.should == :done
+
+    calls.should            == [['<Notify>/A', '<Notify>/B']]
+    calls[0].frozen?.should == true
+
+    Gtk3::AccelMap.remove_changed_handler(handler).should == true
+    Gtk3::AccelMap.remove_changed_handler(handler).should == false
+  end
+
+  it 'Raise errors of change handlers from the main loop' do
+    calls   = []
+    failing = Gtk3::AccelMap.on_changed { raise ArgumentError, 'failed' }
+    handler = Gtk3::AccelMap.on_changed { |paths| calls << paths }
+
+    Gtk3::AccelMap.add_entry('<Notify>/Error', 97, :control)
+    Gtk3::AccelMap.change_entry('<Notify>/Error', 98, :control, true)
+
+    error = should.raise?(ArgumentError) do
+      Gtk3.main_iteration while Gtk3.events_pending?
+    end
+
+    error.message.should == 'failed'
+    calls.should         == [['<Notify>/Error']]
+
+    Gtk3::AccelMap.remove_changed_handler(failing)
+    Gtk3::AccelMap.remove_changed_handler(handler)
+  end
 end
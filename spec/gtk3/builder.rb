@@ -0,0 +1,70 @@
+require File.expand_path('../../helper', __FILE__)
+
+describe 'Gtk3::Builder' do
+  definition = <<-XML
+<interface>
+  <object class="GtkWindow" id="main">
+    <signal name="destroy" handler="on_destroy"/>
+    <child>
+      <object class="GtkBox" id="box">
+        <child>
+          <object class="GtkLabel" id="status">
+            <signal name="destroy" handler="on_destroy"/>
+          </object>
+        </child>
+      </object>
+    </child>
+  </object>
+</interface>
+  XML
+
+  it 'Load objects from a String' do
+    builder = Gtk3::Builder.new.add_from_string(definition)
+
+    builder['main'].is_a?(Gtk3::Window).should == true
+    builder[:box].is_a?(Gtk3::Box).should      == true
+    builder['main'].should                     == builder['main']
+    builder['box'].children.should             == [builder['status']]
+    builder['missing'].should                  == nil
+
+    builder['main'].destroy
+  end
+
+  it 'Load objects from invalid definitions' do
+    should.raise?(Gtk3::Error) do
+      Gtk3::Builder.new.add_from_string('<interface><object>')
+    end
+
+    should.raise?(IOError) do
+      Gtk3::Builder.new.add_from_file('/does/not/exist.ui')
+    end
+  end
+
+  it 'Connect signals to the methods of a handler' do
+    handler = Class.new do
+      attr_reader :destroyed
+
+      def initialize
+        @destroyed = []
+      end
+
+      def on_destroy(widget)
+        @destroyed << widget
+      end
+    end.new
+
+    builder = Gtk3::Builder.new.add_from_string(definition)
+    window  = builder['main']
+    label   = builder['status']
+
+    builder.connect_signals(handler).should == builder
+
+    window.destroy
+
+    handler.destroyed.should == [window, label]
+
+    should.raise?(NameError) do
+      Gtk3::Builder.new.add_from_string(definition).connect_signals(Object.new)
+    end
+  end
+end
@@ -0,0 +1,81 @@
+require File.expand_path('../../helper', __FILE__)
+require 'tmpdir'
+
+describe 'Gtk3 GBytes bridge' do
+  path = '/com/example/spec/main.ui'
+
+  # Compiles a bundle containing a single UI definition and returns its data.
+  compile = lambda do |dir|
+    File.open(File.join(dir, 'main.ui'), 'w') do |handle|
+      handle.write('<interface><object class="GtkBox" id="box"/></interface>')
+    end
+
+    File.open(File.join(dir, 'app.gresource.xml'), 'w') do |handle|
+      handle.write(
+        '<gresources><gresource prefix="/com/example/spec">' \
+          '<file>main.ui</file>' \
+        '</gresource></gresources>'
+      )
+    end
+
+    system(
+      'glib-compile-resources',
+      "--sourcedir=#{dir}",
+      "--target=#{dir}/app.gresource",
+      "#{dir}/app.gresource.xml"
+    )
+
+    File.open(File.join(dir, 'app.gresource'), 'rb') { |handle| handle.read }
+  end
+
+  # Returns a finalizer that records the object IDs in the given list. This
+  # is created outside of the block that creates the String, otherwise the
+  # finalizer would keep the String alive.
+  finalizer = lambda { |list| lambda { |id| list << id } }
+
+  it 'Share the data of frozen Strings' do
+    Dir.mktmpdir do |dir|
+      released = []
+      bundle   = lambda do
+        data = compile.call(dir).freeze
+
+        ObjectSpace.define_finalizer(data, finalizer.call(released))
+
+        Gtk3::Resource.from_data(data)
+      end.call
+
+      GC.start
+
+      released.empty?.should                        == true
+      bundle.lookup(path).include?('GtkBox').should == true
+    end
+  end
+
+  it 'Copy the data of Strings that are not frozen' do
+    Dir.mktmpdir do |dir|
+      data   = compile.call(dir)
+      bundle = Gtk3::Resource.from_data(data)
+
+      data.replace('x' * data.bytesize)
+
+      GC.start
+
+      bundle.lookup(path).include?('GtkBox').should == true
+    end
+  end
+
+  it 'Keep the data of a GBytes alive after garbage collection' do
+    Dir.mktmpdir do |dir|
+      bundle = Gtk3::Resource.from_data(compile.call(dir).freeze)
+      data   = bundle.lookup(path)
+      part   = data[0, 11]
+      bundle = nil
+
+      GC.start
+
+      data.include?('GtkBox').should == true
+      data.frozen?.should            == true
+      part.should                    == '<interface>'
+    end
+  end
+end
@@ -0,0 +1,110 @@
+require File.expand_path('../../helper', __FILE__)
+
+describe 'Gtk3::Container' do
+  it 'Add and remove children' do
+    box   = Gtk3::Box.new(:vertical, 4)
+    label = Gtk3.create(:GtkLabel)
+
+    box.is_a?(Gtk3::Container).should              == true
+    Gtk3::Window.new.is_a?(Gtk3::Container).should == true
+
+    box.spacing.should       == 4
+    box.add(label).should    == box
+    box.children.should      == [label]
+    box.remove(label).should == box
+    box.children.should      == []
+
+    should.raise?(ArgumentError) { box.remove(label) } \
+      .message.should == "the widget isn't a child of the container"
+
+    should.raise?(ArgumentError) { Gtk3::Box.new(:diagonal) } \
+      .message.should == \
+        'invalid orientation :diagonal (expected :horizontal or :vertical)'
+  end
+
+  it 'Add many children at once' do
+    box    = Gtk3::Box.new
+    labels = Array.new(3) { Gtk3.create(:GtkLabel) }
+
+    box.add_all(labels).should == box
+    box.children.should        == labels
+
+    other  = Gtk3::Box.new
+    single = Gtk3.create(:GtkLabel)
+
+    should.raise?(ArgumentError) { other.add_all([single, labels[0]]) } \
+      .message.should == 'the child at index 1 has a parent'
+
+    should.raise?(ArgumentError) { other.add_all([single, single]) } \
+      .message.should == 'the child at index 1 is a duplicate'
+
+    should.raise?(TypeError) { other.add_all([single, 10]) }
+
+    other.children.should == []
+  end
+
+  it 'Reject toplevel windows and extra children of bins' do
+    box    = Gtk3::Box.new
+    window = Gtk3::Window.new
+    labels = Array.new(2) { Gtk3.create(:GtkLabel) }
+
+    should.raise?(ArgumentError) { box.add(window) } \
+      .message.should == 'the child is a toplevel window'
+
+    should.raise?(ArgumentError) { box.pack_start(window) } \
+      .message.should == 'the child is a toplevel window'
+
+    should.raise?(ArgumentError) { box.add_all([labels[0], window]) } \
+      .message.should == 'the child at index 1 is a toplevel window'
+
+    should.raise?(ArgumentError) { window.add_all(labels) } \
+      .message.should == \
+        "the child at index 1 doesn't fit in a bin with a child"
+
+    window.children.should == []
+
+    window.add(labels[0])
+
+    should.raise?(ArgumentError) { window.add(labels[1]) } \
+      .message.should == "the child doesn't fit in a bin with a child"
+
+    box.children.should == []
+
+    window.destroy
+  end
+
+  it 'Attach many children to a grid' do
+    grid  = Gtk3::Grid.new
+    name  = Gtk3.create(:GtkLabel)
+    value = Gtk3.create(:GtkLabel)
+
+    grid.attach_all([[name, 0, 0], [value, 1, 0, 2, 1]]).should == grid
+
+    grid.children.length.should == 2
+
+    should.raise?(ArgumentError) { grid.attach_all([[name, 0]]) } \
+      .message.should == 'invalid specification at index 0 (expected ' \
+        '[child, left, top] or [child, left, top, width, height])'
+
+    should.raise?(TypeError) { grid.attach_all([10]) }
+
+    other = Gtk3.create(:GtkLabel)
+
+    should.raise?(ArgumentError) { grid.attach_all([[other, 0, 1, 0, 1]]) } \
+      .message.should == 'invalid size 0x1 at index 0 (expected at least 1x1)'
+
+    should.raise?(ArgumentError) { grid.attach_all([[other, 0, 1, 1, -2]]) }
+
+    should.raise?(ArgumentError) { grid.attach(other, 0, 1, 0, 1) } \
+      .message.should == 'invalid size 0x1 (expected at least 1x1)'
+
+    window = Gtk3::Window.new
+
+    should.raise?(ArgumentError) { grid.attach(window, 0, 1) } \
+      .message.should == 'the child is a toplevel window'
+
+    grid.children.length.should == 2
+
+    window.destroy
+  end
+end
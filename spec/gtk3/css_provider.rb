@@ -0,0 +1,137 @@
+require File.expand_path('../../helper', __FILE__)
+require 'tempfile'
+require 'tmpdir'
+
+describe 'Gtk3::CssProvider' do
+  it 'Load a style sheet from a String' do
+    provider = Gtk3::CssProvider.new
+
+    provider.load_from_data('label { color: red; }').should == provider
+
+    provider.to_s.include?('color').should == true
+
+    should.raise?(Gtk3::Error) do
+      provider.load_from_data('label { color: }')
+    end
+  end
+
+  it 'Load a style sheet from a file' do
+    file     = Tempfile.new('gtk3-css')
+    provider = Gtk3::CssProvider.new
+
+    file.write('button { padding: 4px; }')
+    file.flush
+
+    provider.load_from_path(file.path).to_s.include?('padding').should == true
+
+    should.raise?(IOError) do
+      provider.load_from_path('/does/not/exist.css')
+    end
+
+    file.close
+  end
+
+  it 'Load a style sheet asynchronously' do
+    file     = Tempfile.new('gtk3-css')
+    provider = Gtk3::CssProvider.new
+    result   = nil
+
+    file.write('entry { margin: 2px; }')
+    file.flush
+
+    provider.load_async(file.path) { |value| result = value }.should == nil
+
+    Gtk3.main_iteration while result.nil?
+
+    result.should                           == true
+    provider.to_s.include?('margin').should == true
+
+    file.close
+  end
+
+  it 'Report errors when loading asynchronously' do
+    provider = Gtk3::CssProvider.new
+    result   = nil
+
+    provider.load_async('/does/not/exist.css') { |value| result = value }
+
+    Gtk3.main_iteration while result.nil?
+
+    result.is_a?(IOError).should == true
+  end
+
+  it 'Load a style sheet asynchronously from a resource' do
+    Dir.mktmpdir do |dir|
+      File.open(File.join(dir, 'theme.css'), 'w') do |handle|
+        handle.write('frame { border-width: 3px; }')
+      end
+
+      File.open(File.join(dir, 'css.gresource.xml'), 'w') do |handle|
+        handle.write(
+          '<gresources><gresource prefix="/com/example/css">' \
+            '<file>theme.css</file>' \
+          '</gresource></gresources>'
+        )
+      end
+
+      system(
+        'glib-compile-resources',
+        "--sourcedir=#{dir}",
+        "--target=#{dir}/css.gresource",
+        "#{dir}/css.gresource.xml"
+      )
+
+      bundle   = Gtk3::Resource.load("#{dir}/css.gresource").register
+      provider = Gtk3::CssProvider.new
+      result   = nil
+
+      provider.load_async('resource:///com/example/css/theme.css') do |value|
+        result = value
+      end
+
+      Gtk3.main_iteration while result.nil?
+
+      result.should                                 == true
+      provider.to_s.include?('border-width').should == true
+
+      result = nil
+
+      provider.load_async('resource:///com/example/css/other.css') do |value|
+        result = value
+      end
+
+      Gtk3.main_iteration while result.nil?
+
+      result.is_a?(IOError).should == true
+
+      bundle.unregister
+    end
+  end
+
+  it 'Raise errors of asynchronous load callbacks from the main loop' do
+    provider = Gtk3::CssProvider.new
+    done     = false
+
+    provider.load_async('/does/not/exist.css') do
+      done = true
+
+      raise ArgumentError, 'callback failed'
+    end
+
+    error = should.raise?(ArgumentError) do
+      Gtk3.main_iteration until done
+    end
+
+    error.message.should == 'callback failed'
+  end
+
+  it 'Add a provider to the default screen' do
+    provider = Gtk3::CssProvider.new.load_from_data('label { color: red; }')
+
+    provider.add_to_screen.should      == provider
+    provider.remove_from_screen.should == provider
+
+    provider.add_to_screen(Gtk3::CssProvider::PRIORITY_USER)
+    provider.remove_from_screen
+  end
+end
@@ -0,0 +1,40 @@
+require File.expand_path('../../helper', __FILE__)
+require 'rbconfig'
+
+describe 'Gtk3.init' do
+  it 'Initialize GTK using command line arguments' do
+    Gtk3.init(['--gtk3-spec', 'file.txt']).should == ['--gtk3-spec', 'file.txt']
+    Gtk3.initialized?.should                      == true
+
+    should.raise?(TypeError) { Gtk3.init(10) }
+  end
+
+  it 'Require the extension without a display' do
+    library = File.expand_path('../../../lib/gtk3', __FILE__)
+    script  = <<-RUBY
+      require #{library.inspect}
+
+      exit(1) if Gtk3.initialized?
+
+      Gtk3::AccelGroup.accelerator_label(113, :control)
+      Gtk3::AccelMap.add_entry('<Headless>/Test', 113, :control)
+
+      exit(1) unless Gtk3::AccelMap.lookup_entry('<Headless>/Test').key == 113
+
+      begin
+        Gtk3::Window.new
+      rescue RuntimeError => error
+        exit(error.message.include?('display') ? 0 : 1)
+      end
+
+      exit(1)
+    RUBY
+
+    env     = {'DISPLAY' => nil, 'WAYLAND_DISPLAY' => nil}
+    command = [env, RbConfig.ruby, '-e', script, {:err => [:child, :out]}]
+    output  = IO.popen(command) { |handle| handle.read }
+
+    $?.success?.should                 == true
+    output.include?('CRITICAL').should == false
+  end
+end
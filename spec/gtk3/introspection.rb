@@ -0,0 +1,48 @@
+require File.expand_path('../../helper', __FILE__)
+
+describe 'Gtk3 introspection' do
+  it 'Define classes on first use' do
+    Gtk3::Label.superclass.superclass.should == Gtk3::Widget
+    Gtk3.create(:GtkLabel).class.should      == Gtk3::Label
+
+    should.raise?(NameError) { Gtk3::DoesNotExist }
+  end
+
+  it 'Define methods on first use' do
+    label = Gtk3.create(:GtkLabel)
+
+    label.respond_to?(:set_text).should == true
+
+    label.set_text('Saved').should == nil
+    label.get_text.should          == 'Saved'
+    label.get_name.should          == 'GtkLabel'
+
+    Gtk3::Label.method_defined?(:set_text).should  == true
+    Gtk3::Widget.method_defined?(:get_name).should == true
+  end
+
+  it 'Call constructors and class level functions' do
+    label = Gtk3::Label.new('Open')
+
+    label.class.should    == Gtk3::Label
+    label.get_text.should == 'Open'
+
+    Gtk3::Label.new_with_mnemonic('_Save').get_mnemonic_keyval.should == 115
+  end
+
+  it 'Convert arguments and report unsupported methods' do
+    label = Gtk3::Label.new('Open')
+
+    label.set_selectable(true)
+    label.get_selectable.should == true
+
+    should.raise?(ArgumentError) { label.set_text } \
+      .message.should == 'wrong number of arguments(0 for 1)'
+
+    should.raise?(TypeError) { label.set_selectable('yes') }
+
+    # Methods with output arguments aren't supported.
+    should.raise?(NoMethodError) { label.get_layout_offsets }
+    should.raise?(NoMethodError) { label.does_not_exist }
+  end
+end if Gtk3::INTROSPECTION
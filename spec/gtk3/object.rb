@@ -0,0 +1,101 @@
+require File.expand_path('../../helper', __FILE__)
+
+describe 'Gtk3.create' do
+  it 'Create an object using a type name' do
+    window = Gtk3.create(:GtkWindow, :title => 'Example', :modal => true)
+
+    window.is_a?(Gtk3::Window).should == true
+    window.title.should               == 'Example'
+    window.modal?.should              == true
+
+    window.destroy
+  end
+
+  it 'Create an object using a class' do
+    window = Gtk3.create(Gtk3::Window, 'default-width' => 100)
+
+    window.is_a?(Gtk3::Window).should == true
+    window[:default_width].should     == 100
+
+    window.destroy
+  end
+
+  it 'Create an object of an unknown or abstract type' do
+    should.raise?(ArgumentError) { Gtk3.create(:GtkDoesNotExist) } \
+      .message.should == 'unknown type GtkDoesNotExist'
+
+    should.raise?(ArgumentError) { Gtk3.create(:GtkWidget) } \
+      .message.should == 'GtkWidget can not be instantiated'
+
+    should.raise?(TypeError) { Gtk3.create(10) }
+  end
+
+  it 'Create an object that is not a widget' do
+    group = Gtk3.create('GtkAccelGroup')
+
+    group.is_a?(Gtk3::AccelGroup).should == true
+    group.locked?.should                 == false
+  end
+end
+
+describe 'Gtk3::Object' do
+  it 'Convert enum values using their names' do
+    window = Gtk3::Window.new
+
+    window.set(:window_position => :center_always)
+    window[:window_position].should == 3
+
+    window.set(:window_position => 'center')
+    window[:window_position].should == 1
+
+    should.raise?(ArgumentError) { window.set(:window_position => :foo) } \
+      .message.should == 'invalid GtkWindowPosition value foo'
+
+    long = 'center_' * 10
+
+    should.raise?(ArgumentError) { window.set(:window_position => long) } \
+      .message.should == "invalid GtkWindowPosition value #{long}"
+
+    window.destroy
+  end
+
+  it 'Convert object values using the identity map' do
+    parent = Gtk3::Window.new
+    window = Gtk3::Window.new
+
+    window[:transient_for].should == nil
+
+    window.set(:transient_for => parent)
+    window[:transient_for].equal?(parent).should == true
+
+    should.raise?(TypeError) { window.set(:transient_for => 'parent') }
+    should.raise?(TypeError) { window.set(:transient_for => Gtk3::AccelGroup.new) }
+
+    window.destroy
+    parent.destroy
+  end
+
+  it 'Wrap objects of which the Ruby object was garbage collected' do
+    window = Gtk3::Window.new
+
+    lambda { window.set(:transient_for => Gtk3::Window.new) }.call
+
+    GC.start
+
+    parent = window[:transient_for]
+
+    parent.is_a?(Gtk3::Window).should            == true
+    window[:transient_for].equal?(parent).should == true
+
+    window.destroy
+    parent.destroy
+  end
+
+  it 'Refuse to convert values of the wrong type' do
+    window = Gtk3::Window.new
+
+    should.raise?(TypeError) { window.set(:default_width => 1.5) }
+
+    window.destroy
+  end
+end
@@ -0,0 +1,76 @@
+require File.expand_path('../../helper', __FILE__)
+require 'tmpdir'
+
+describe 'Gtk3::Resource' do
+  # Compiles a bundle containing a single UI definition and returns its path.
+  compile = lambda do |dir|
+    File.open(File.join(dir, 'main.ui'), 'w') do |handle|
+      handle.write('<interface><object class="GtkBox" id="box"/></interface>')
+    end
+
+    File.open(File.join(dir, 'app.gresource.xml'), 'w') do |handle|
+      handle.write(
+        '<gresources><gresource prefix="/com/example/spec">' \
+          '<file>main.ui</file>' \
+        '</gresource></gresources>'
+      )
+    end
+
+    system(
+      'glib-compile-resources',
+      "--sourcedir=#{dir}",
+      "--target=#{dir}/app.gresource",
+      "#{dir}/app.gresource.xml"
+    )
+
+    File.join(dir, 'app.gresource')
+  end
+
+  it 'Load a bundle and look up resources' do
+    Dir.mktmpdir do |dir|
+      bundle = Gtk3::Resource.load(compile.call(dir))
+      data   = bundle.lookup('/com/example/spec/main.ui')
+
+      data.include?('GtkBox').should == true
+      data.frozen?.should            == true
+
+      bundle.lookup('resource:///com/example/spec/main.ui').should == data
+
+      bundle.exists?('/com/example/spec/main.ui').should  == true
+      bundle.exists?('/com/example/spec/other.ui').should == false
+      bundle.children('/com/example/spec/').should        == ['main.ui']
+
+      should.raise?(IOError) { bundle.lookup('/does/not/exist') }
+    end
+  end
+
+  it 'Load a bundle from a String' do
+    Dir.mktmpdir do |dir|
+      data   = File.open(compile.call(dir), 'rb') { |handle| handle.read }
+      bundle = Gtk3::Resource.from_data(data.freeze)
+
+      bundle.exists?('/com/example/spec/main.ui').should == true
+    end
+  end
+
+  it 'Use registered bundles with resource:// paths' do
+    Dir.mktmpdir do |dir|
+      bundle = Gtk3::Resource.load(compile.call(dir)).register
+      uri    = 'resource:///com/example/spec/main.ui'
+
+      Gtk3::Resource.lookup(uri).include?('GtkBox').should == true
+
+      Gtk3::Builder.new.add_from_file(uri)['box'].is_a?(Gtk3::Box) \
+        .should == true
+
+      bundle.unregister
+
+      should.raise?(IOError) { Gtk3::Resource.lookup(uri) }
+    end
+  end
+
+  it 'Load invalid bundles' do
+    should.raise?(IOError) { Gtk3::Resource.load('/does/not/exist') }
+    should.raise?(IOError) { Gtk3::Resource.from_data('invalid') }
+  end
+end
@@ -43,6 +43,24 @@ describe 'Gtk3::Widget' do
     id.should > 0
   end
 
+  it 'Raise errors of signal handlers once control returns to Ruby' do
+    window = Gtk3::Window.new
+    called = nil
+
+    window.connect(:destroy) do |object|
+      called = object
+
+      raise 'destroyed'
+    end
+
+    window.destroy
+
+    called.equal?(window).should == true
+
+    should.raise?(RuntimeError) { Gtk3.main_iteration } \
+      .message.should == 'destroyed'
+  end
+
   it 'Map and unmap a widget' do
     window = Gtk3::Window.new
 
@@ -109,6 +127,25 @@ describe 'Gtk3::Widget' do
     window.destroy
   end
 
+  it 'Send key presses to realized widgets' do
+    window  = Gtk3::Window.new
+    pressed = []
+
+    window.connect('key-press-event') { pressed << :key }
+
+    window.send_key(:a, 0).should == false
+
+    window.show
+
+    window.send_key(:a, 0).should == true
+
+    Gtk3.main_iteration while Gtk3.events_pending?
+
+    pressed.should == [:key]
+
+    window.destroy
+  end
+
   it 'Get the allocated dimensions of a widget' do
     window = Gtk3::Window.new
 
@@ -138,4 +175,95 @@ describe 'Gtk3::Widget' do
 
     window.destroy
   end
+
+  it 'Set and get multiple properties' do
+    window = Gtk3::Window.new
+
+    window.set(:title => 'Example', 'default-width' => 200).should == window
+
+    window.get(:title).should                 == 'Example'
+    window.get(:title, :default_width).should == ['Example', 200]
+    window[:default_width].should             == 200
+    window['default-width'].should            == 200
+
+    window.destroy
+  end
+
+  it 'Set properties using invalid names or values' do
+    window = Gtk3::Window.new
+
+    should.raise?(ArgumentError) { window.set(:does_not_exist => 10) } \
+      .message.should =~ /unknown property does_not_exist/
+
+    should.raise?(TypeError) { window.set(:title => 10) }
+    should.raise?(TypeError) { window.set(10 => 10) }
+    should.raise?(ArgumentError) { window.get }
+
+    window.title.should == nil
+
+    window.destroy
+  end
+
+  it 'Traverse and query the descendants of a widget' do
+    window = Gtk3::Window.new
+    box    = Gtk3.create(:GtkBox)
+    save   = Gtk3.create(:GtkButton, :name => 'save')
+    label  = Gtk3.create(:GtkLabel, :name => 'status')
+    inner  = Gtk3.create(:GtkLabel)
+
+    save.set(:child => inner)
+    box.set(:child => save)
+    box.set(:child => label)
+    window.set(:child => box)
+
+    window.each_descendant.to_a.should           == [box, save, inner, label]
+    window.each_descendant(:breadth).to_a.should == [box, save, label, inner]
+
+    window.find_all(:type => :GtkLabel).should             == [inner, label]
+    window.find_all(:name => 'save').should                == [save]
+    window.find_all(:css_class => 'does-not-exist').should == []
+
+    window.find_first(:type => :GtkLabel).should == inner
+    window.find_first(:name => 'nothing').should == nil
+
+    # Criteria in other encodings are transcoded to UTF-8.
+    window.find_all(:name => 'save'.encode('UTF-16LE')).should == [save]
+
+    should.raise?(ArgumentError) { window.each_descendant(:sideways) {} } \
+      .message.should == \
+        'invalid traversal order :sideways (expected :depth or :breadth)'
+
+    window.destroy
+  end
+
+  it 'Add and remove style classes in batches' do
+    window = Gtk3::Window.new
+    button = Gtk3.create(:GtkButton)
+
+    window.set(:child => button)
+
+    button.add_classes('first', :second).should == button
+    button.has_class?(:second).should           == true
+
+    window.realize
+
+    button.add_classes('third', 'fourth')
+    button.remove_classes('first', 'fourth')
+
+    (button.css_classes & %w{first second third fourth}).sort \
+      .should == %w{second third}
+
+    window.find_all(:css_class => 'third').should  == [button]
+    window.find_all(:css_class => 'fourth').should == []
+
+    button.add_classes('fifth')
+
+    Gtk3.main_iteration while Gtk3.events_pending?
+
+    button.has_class?('fifth').should == true
+
+    should.raise?(TypeError) { button.add_classes(10) }
+
+    window.destroy
+  end
 end
@@ -1,6 +1,14 @@
 require File.expand_path('../../helper', __FILE__)
 
 describe 'Gtk3::Window' do
+  # Types a key in a window through the windowing system and waits until GTK
+  # has processed it.
+  type = lambda do |window, key, modifier|
+    window.send_key(key, modifier).should == true
+
+    Gtk3.main_iteration while Gtk3.events_pending?
+  end
+
   it 'Set the title of a window' do
     window = Gtk3::Window.new
 
@@ -13,6 +21,63 @@ describe 'Gtk3::Window' do
     window.destroy
   end
 
+  it 'Re-use the String of an unchanged title' do
+    window = Gtk3::Window.new
+
+    window.title = 'Cached title'
+
+    misses = Gtk3.string_cache_stats[:misses]
+    title  = window.title
+
+    title.frozen?.should              == true
+    window.title.equal?(title).should == true
+
+    Gtk3.string_cache_stats[:misses].should == misses + 1
+
+    window.title = 'Other title'
+
+    window.title.should == 'Other title'
+
+    window.destroy
+  end
+
+  it 'Limit the size of the String cache' do
+    window = Gtk3::Window.new
+
+    32.times do |index|
+      window.title = index.to_s * 16 * 1024
+
+      window.title
+    end
+
+    Gtk3.string_cache_stats[:bytes].should <= 256 * 1024
+
+    window.title = 'Recent title'
+    title        = window.title
+
+    window.title.equal?(title).should == true
+
+    window.title = 'x' * 512 * 1024
+
+    window.title.equal?(window.title).should == false
+
+    window.destroy
+  end
+
+  it 'Convert the title of a window to UTF-8' do
+    window = Gtk3::Window.new
+
+    window.title = "caf\xE9".force_encoding('ISO-8859-1')
+
+    window.title.should          == "caf\u00E9"
+    window.title.encoding.should == Encoding::UTF_8
+
+    should.raise?(ArgumentError) { window.title = "caf\xE9" } \
+      .message.should == 'invalid byte sequence in UTF-8'
+
+    window.destroy
+  end
+
   it 'Sets whether the window can be resized by the user' do
     window = Gtk3::Window.new
 
@@ -100,4 +165,103 @@ describe 'Gtk3::Window' do
 
     window.destroy
   end
+
+  it 'Bind and unbind key sequences' do
+    window = Gtk3::Window.new
+
+    window.bind_sequence('<Control>x <Control>s') {}
+    window.bind_sequence('<Control>x  <Control>c', proc {})
+
+    window.unbind_sequence('<Control>x <Control>s').should == true
+    window.unbind_sequence('<Control>x <Control>s').should == false
+    window.unbind_sequence('<Control>x').should            == false
+
+    window.sequence_timeout.should == 1000
+
+    window.sequence_timeout = 500
+
+    window.sequence_timeout.should == 500
+
+    window.destroy
+  end
+
+  it 'Call key sequences typed in a window' do
+    window   = Gtk3::Window.new
+    called   = []
+    prefixes = []
+
+    window.on_sequence_prefix { |prefix| prefixes << prefix }
+
+    window.bind_sequence('<Control>x <Control>s') { called << :save }
+    window.bind_sequence('<Control>x k') { called << :kill }
+
+    window.show
+
+    type.call(window, :x, :control)
+    type.call(window, :s, :control)
+
+    called.should   == [:save]
+    prefixes.should == ['<Primary>x', nil]
+
+    # Keys that don't continue the current sequence cancel it.
+    type.call(window, :x, :control)
+    type.call(window, :q, :control)
+    type.call(window, :k, 0)
+
+    called.should        == [:save]
+    prefixes.last.should == nil
+
+    type.call(window, :x, :control)
+    type.call(window, :k, 0)
+
+    called.should == [:save, :kill]
+
+    window.destroy
+  end
+
+  it 'Raise errors of key sequences once control returns to Ruby' do
+    window = Gtk3::Window.new
+
+    window.bind_sequence('<Control>x <Control>s') { raise 'failed' }
+
+    window.show
+
+    type.call(window, :x, :control)
+
+    window.send_key(:s, :control).should == true
+
+    should.raise?(RuntimeError) do
+      Gtk3.main_iteration while Gtk3.events_pending?
+    end.message.should == 'failed'
+
+    window.destroy
+  end
+
+  it 'Read the sequence timeout without binding sequences' do
+    window = Gtk3::Window.new
+
+    window.sequence_timeout.should == 1000
+
+    window.destroy
+  end
+
+  it 'Bind conflicting or invalid key sequences' do
+    window = Gtk3::Window.new
+
+    window.bind_sequence('<Control>x <Control>s') {}
+
+    should.raise?(ArgumentError) { window.bind_sequence('<Control>x') {} } \
+      .message.should == '<Control>x conflicts with the sequence <Primary>x'
+
+    should.raise?(ArgumentError) do
+      window.bind_sequence('<Control>x <Control>s a') {}
+    end
+
+    should.raise?(ArgumentError) { window.bind_sequence('<Foo') {} } \
+      .message.should == 'invalid key sequence <Foo'
+
+    should.raise?(ArgumentError) { window.bind_sequence('<Control>y') }
+
+    window.destroy
+  end
 end